@@ -0,0 +1,93 @@
+/*
+Example for ADC_7 Click
+
+    Date          : Oct 2026.
+    Author        : MikroE FW Team
+
+Test configuration LINUX :
+    
+    Host             : x86_64 / aarch64 Linux
+    HAL              : __HAL_LINUX.c (LTC2500 simulator, library/__adc7_sim.c)
+    Compiler         : gcc
+
+    gcc -I../../../library Click_ADC_7_LINUX.c ../../../library/__adc7_driver.c \
+        ../../../library/__adc7_sim.c -o Click_ADC_7_LINUX
+
+---
+
+Description :
+
+The application is composed of three sections :
+
+- System Initialization - Initializes the simulator and sets the input voltage.
+- Application Initialization - Initializes SPI interface and performs configuration for conversion cycles.
+- Application Task - (code snippet) - Performs the determined number of conversion cycles which are necessary for averaging.
+  When all conversion cycles are done, then reads the converted voltage value.
+  Results will be logged on standard output together with the simulated time.
+  Waits are bounded, on a timeout the driver resets and reconfigures the device and the sample is skipped.
+
+*/
+
+#include <stdio.h>
+#include "Click_ADC_7_types.h"
+#include "__adc7_driver.h"
+#include "__adc7_sim.h"
+
+int16_t voltageData;
+double inputVoltage = 1234.5;
+
+void systemInit()
+{
+    adc7sim_init();
+    adc7sim_setInput( 0, inputVoltage );
+
+    printf( "Initializing...\n" );
+}
+
+void applicationInit()
+{
+    adc7_spiDriverInit( (T_ADC7_P)&_MIKROBUS1_GPIO, (T_ADC7_P)&_MIKROBUS1_SPI );
+    Delay_ms( 300 );
+    
+    adc7_presetMode( _ADC7_LOW_STATE );
+    while (adc7_checkBusy() == _ADC7_DEVICE_IS_BUSY);
+    adc7_setConfig( _ADC7_GAIN_DISABLE, _ADC7_DOWNSAMPL_FACT_64, _ADC7_AVERAGING_FILT );
+    while (adc7_checkBusy() == _ADC7_DEVICE_IS_BUSY);
+    adc7_setTimeout( 10000, 1 );
+    
+    printf( "ADC 7 is initialized\n\n" );
+}
+
+void applicationTask()
+{
+    uint64_t start = adc7sim_now();
+
+    if (adc7_startConvCycle() || adc7_waitDataReady())
+    {
+        printf( "Timeout, device recovered\n" );
+        return;
+    }
+    
+    adc7_readResults( &voltageData );
+    
+    printf( "Voltage:  %d mV  (input %.1f mV, %llu ns)\n", voltageData, inputVoltage,
+            (unsigned long long)(adc7sim_now() - start) );
+}
+
+int main()
+{
+    int count;
+
+    systemInit();
+    applicationInit();
+
+    for (count = 0; count < 10; count++)
+    {
+        applicationTask();
+
+        inputVoltage -= 321.0;
+        adc7sim_setInput( 0, inputVoltage );
+    }
+
+    return 0;
+}
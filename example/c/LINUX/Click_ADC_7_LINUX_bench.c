@@ -0,0 +1,177 @@
+/*
+Benchmark for ADC_7 Click
+
+    Date          : Oct 2026.
+    Author        : MikroE FW Team
+
+Test configuration LINUX :
+    
+    Host             : x86_64 / aarch64 Linux
+    HAL              : __HAL_LINUX.c (LTC2500 simulator, library/__adc7_sim.c)
+    Compiler         : gcc
+
+    gcc -O2 -I../../../library Click_ADC_7_LINUX_bench.c ../../../library/__adc7_driver.c \
+        ../../../library/__adc7_sim.c -o Click_ADC_7_LINUX_bench
+    (add -D__HAL_GPIO_STATIC__ for pin accessors bound at compile time)
+    ./Click_ADC_7_LINUX_bench [samples per configuration] [gpio | train] > bench.jsonl
+
+---
+
+Description :
+
+Drives adc7_startConvCycle, adc7_checkDataReady and adc7_readResults for every down sampling factor
+and filter type and emits one JSON object per configuration :
+
+- sim_sps, host_sps          - filtered samples per second in simulated (target) time and host wall time
+- lat_p50_ns ... lat_max_ns  - per-sample latency (start of conversion cycle to result) in simulated time
+- gpio_ns, spi_ns            - simulated time spent in GPIO accesses (MCK, BUSY and DRL polling) and SPI transfers
+- gpio_reads, spi_bytes      - access counts
+- gpio_calls                 - GPIO accesses made through the mapped function pointers (0 with __HAL_GPIO_STATIC__)
+- mck_rate                   - achieved conversion rate in Hz
+
+gpio_ns is the access counts times the per access costs of the simulator timing model (tGpio, and tCall
+for gpio_calls), which are set with adc7sim_setTiming. It is not a measurement, the cost of pointer
+dispatched accesses has to be measured on the target.
+
+MCK is bit-banged by the driver (gpio, default) or generated by the simulated timer (train).
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "__adc7_driver.h"
+#include "__adc7_sim.h"
+
+#define SAMPLES_DEF     64
+
+static const uint8_t *downSampFactors[] =
+{
+    &_ADC7_DOWNSAMPL_FACT_4,    &_ADC7_DOWNSAMPL_FACT_8,    &_ADC7_DOWNSAMPL_FACT_16,
+    &_ADC7_DOWNSAMPL_FACT_32,   &_ADC7_DOWNSAMPL_FACT_64,   &_ADC7_DOWNSAMPL_FACT_128,
+    &_ADC7_DOWNSAMPL_FACT_256,  &_ADC7_DOWNSAMPL_FACT_512,  &_ADC7_DOWNSAMPL_FACT_1024,
+    &_ADC7_DOWNSAMPL_FACT_2048, &_ADC7_DOWNSAMPL_FACT_4096, &_ADC7_DOWNSAMPL_FACT_8192,
+    &_ADC7_DOWNSAMPL_FACT_16384
+};
+
+static const uint8_t *filterTypes[] =
+{
+    &_ADC7_SINC1_FILT, &_ADC7_SINC2_FILT, &_ADC7_SINC3_FILT, &_ADC7_SINC4_FILT,
+    &_ADC7_SSINC_FILT, &_ADC7_FLAT_PASSBAND_FILT, &_ADC7_AVERAGING_FILT
+};
+
+static int compareLatency( const void *a, const void *b )
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static double hostSeconds( void )
+{
+    struct timespec ts;
+
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void runConfig( uint8_t downSampFactor, uint8_t filterType, uint32_t samples, uint64_t *latency )
+{
+    T_adc7sim_stats before;
+    T_adc7sim_stats after;
+    uint64_t simStart;
+    uint64_t simTotal;
+    uint64_t start;
+    double hostStart;
+    double hostTotal;
+    int16_t voltage;
+    uint32_t count;
+
+    adc7_setConfig( _ADC7_GAIN_DISABLE, downSampFactor, filterType );
+    adc7sim_getStats( 0, &before );
+    adc7sim_getMckRate( 0 );
+    simStart = adc7sim_now();
+    hostStart = hostSeconds();
+
+    for (count = 0; count < samples; count++)
+    {
+        start = adc7sim_now();
+
+        adc7_startConvCycle();
+        while (adc7_checkDataReady() == _ADC7_DATA_NOT_READY);
+        adc7_readResults( &voltage );
+
+        latency[ count ] = adc7sim_now() - start;
+    }
+
+    hostTotal = hostSeconds() - hostStart;
+    simTotal = adc7sim_now() - simStart;
+    adc7sim_getStats( 0, &after );
+    qsort( latency, samples, sizeof( uint64_t ), compareLatency );
+
+    printf( "{\"df\":%u,\"filter\":%u,\"samples\":%u,"
+            "\"sim_sps\":%.1f,\"host_sps\":%.1f,"
+            "\"lat_p50_ns\":%llu,\"lat_p90_ns\":%llu,\"lat_p99_ns\":%llu,\"lat_max_ns\":%llu,"
+            "\"gpio_ns\":%llu,\"spi_ns\":%llu,\"gpio_reads\":%u,\"spi_bytes\":%u,\"gpio_calls\":%u,"
+            "\"mck_rate\":%u}\n",
+            1u << downSampFactor, filterType, samples,
+            samples / (simTotal * 1e-9), samples / hostTotal,
+            (unsigned long long)latency[ samples * 50 / 100 ],
+            (unsigned long long)latency[ samples * 90 / 100 ],
+            (unsigned long long)latency[ samples * 99 / 100 ],
+            (unsigned long long)latency[ samples - 1 ],
+            (unsigned long long)(after.gpioTime - before.gpioTime),
+            (unsigned long long)(after.spiTime - before.spiTime),
+            after.gpioReads - before.gpioReads,
+            after.spiBytes - before.spiBytes,
+            after.gpioCalls - before.gpioCalls,
+            adc7sim_getMckRate( 0 ) );
+}
+
+int main( int argc, char **argv )
+{
+    uint32_t samples = SAMPLES_DEF;
+    uint64_t *latency;
+    uint8_t dfIdx;
+    uint8_t filtIdx;
+
+    if (argc > 1)
+    {
+        samples = (uint32_t)strtoul( argv[ 1 ], 0, 0 );
+    }
+    if (samples == 0)
+    {
+        return 1;
+    }
+
+    latency = malloc( samples * sizeof( uint64_t ) );
+    if (!latency)
+    {
+        return 1;
+    }
+
+    adc7sim_init();
+    adc7sim_setInput( 0, 1000.0 );
+    adc7_spiDriverInit( (T_ADC7_P)&_MIKROBUS1_GPIO, (T_ADC7_P)&_MIKROBUS1_SPI );
+    adc7_presetMode( _ADC7_LOW_STATE );
+
+    if ((argc > 2) && !strcmp( argv[ 2 ], "train" ))
+    {
+        adc7_setPulseTrain( adc7sim_pulseTrain1, _ADC7_MCK_RATE_MAX );
+    }
+
+    for (dfIdx = 0; dfIdx < sizeof( downSampFactors ) / sizeof( downSampFactors[ 0 ] ); dfIdx++)
+    {
+        for (filtIdx = 0; filtIdx < sizeof( filterTypes ) / sizeof( filterTypes[ 0 ] ); filtIdx++)
+        {
+            runConfig( *downSampFactors[ dfIdx ], *filterTypes[ filtIdx ], samples, latency );
+        }
+    }
+
+    free( latency );
+
+    return 0;
+}
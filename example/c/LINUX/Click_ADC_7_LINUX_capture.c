@@ -0,0 +1,179 @@
+/*
+Example for ADC_7 Click - capture files
+
+    Date          : Oct 2026.
+    Author        : MikroE FW Team
+
+Test configuration LINUX :
+
+    Host             : x86_64 / aarch64 Linux
+    HAL              : __HAL_LINUX.c (LTC2500 simulator, library/__adc7_sim.c)
+    Compiler         : gcc
+
+    gcc -O2 -I../../../library Click_ADC_7_LINUX_capture.c ../../../library/__adc7_driver.c \
+        ../../../library/__adc7_sim.c ../../../library/__adc7_capture.c -lm -o Click_ADC_7_LINUX_capture
+    ./Click_ADC_7_LINUX_capture capture.cap [samples]
+
+---
+
+Description :
+
+The application is composed of three sections :
+
+- System Initialization - Initializes the simulator with a 50 Hz sine input and the virtual clock as timestamp source.
+- Application Initialization - Initializes SPI interface, performs configuration for conversion cycles and creates the capture file.
+- Application Task - (code snippet) - Reads batches of timestamped codes and appends them to the capture.
+  When the capture is complete, the file is mapped and one 20 ms period in the middle is queried by time.
+  Chunk summaries from the index and the statistics of the mapped codes are logged on standard output.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "Click_ADC_7_types.h"
+#include "__adc7_driver.h"
+#include "__adc7_sim.h"
+#include "__adc7_capture.h"
+
+#define BATCH           256
+#define SAMPLES_DEF     1000000
+
+int32_t codes[ BATCH ];
+uint32_t ticks[ BATCH ];
+T_adc7cap_writer writer;
+
+double sineInput( uint8_t slot, uint64_t timeNs )
+{
+    (void)slot;
+
+    return 1500.0 * sin( 2.0 * M_PI * 50.0 * timeNs * 1e-9 );
+}
+
+void systemInit()
+{
+    adc7sim_init();
+    adc7sim_setInputFn( 0, sineInput );
+
+    printf( "Initializing...\n" );
+}
+
+uint8_t applicationInit( const char *path )
+{
+    adc7_spiDriverInit( (T_ADC7_P)&_MIKROBUS1_GPIO, (T_ADC7_P)&_MIKROBUS1_SPI );
+    adc7_setTickSource( adc7sim_tick );
+    adc7_setTimeout( 10000, 1 );
+
+    adc7_presetMode( _ADC7_LOW_STATE );
+    while (adc7_checkBusy() == _ADC7_DEVICE_IS_BUSY);
+    adc7_setConfig( _ADC7_GAIN_DISABLE, _ADC7_DOWNSAMPL_FACT_32, _ADC7_SINC4_FILT );
+    while (adc7_checkBusy() == _ADC7_DEVICE_IS_BUSY);
+
+    if (adc7cap_open( &writer, path, _ADC7_GAIN_DISABLE, _ADC7_DOWNSAMPL_FACT_32, _ADC7_SINC4_FILT, 0, 1000000000 ))
+    {
+        printf( "Cannot create %s\n", path );
+        return 1;
+    }
+
+    printf( "ADC 7 is initialized\n" );
+
+    return 0;
+}
+
+uint8_t applicationTask()
+{
+    if (adc7_readCodesBatchTs( codes, ticks, BATCH ))
+    {
+        printf( "Timeout\n" );
+        return 1;
+    }
+
+    return adc7cap_write( &writer, codes, ticks, BATCH );
+}
+
+void query( const char *path )
+{
+    T_adc7cap_reader reader;
+    T_adc7cap_chunk summary;
+    const int32_t *range;
+    uint64_t nCodes;
+    uint64_t middle;
+    uint64_t count;
+    int32_t minCode;
+    int32_t maxCode;
+
+    if (adc7cap_map( &reader, path ))
+    {
+        printf( "Cannot map %s\n", path );
+        return;
+    }
+
+    adc7cap_summary( &reader, 0, reader.header->nChunks, &summary );
+    printf( "%llu samples in %u chunks, %.3f s, min %ld uV, max %ld uV\n",
+            (unsigned long long)reader.header->nSamples, reader.header->nChunks,
+            (summary.tLast - summary.tFirst) * 1e-9,
+            (long)adc7_codeToMicroVolts( summary.min ), (long)adc7_codeToMicroVolts( summary.max ) );
+
+    // one input period in the middle of the capture
+    middle = (summary.tFirst + summary.tLast) / 2;
+    range = adc7cap_range( &reader, middle, middle + 20000000, &nCodes );
+
+    minCode = range[ 0 ];
+    maxCode = range[ 0 ];
+    for (count = 1; count < nCodes; count++)
+    {
+        if (range[ count ] < minCode)
+        {
+            minCode = range[ count ];
+        }
+        if (range[ count ] > maxCode)
+        {
+            maxCode = range[ count ];
+        }
+    }
+
+    printf( "20 ms at %.3f s: %llu samples, min %ld uV, max %ld uV\n", middle * 1e-9, (unsigned long long)nCodes,
+            (long)adc7_codeToMicroVolts( minCode ), (long)adc7_codeToMicroVolts( maxCode ) );
+
+    adc7cap_unmap( &reader );
+}
+
+int main( int argc, char **argv )
+{
+    unsigned long samples = SAMPLES_DEF;
+    unsigned long count;
+
+    if (argc < 2)
+    {
+        printf( "usage: %s capture.cap [samples]\n", argv[ 0 ] );
+        return 1;
+    }
+    if (argc > 2)
+    {
+        samples = strtoul( argv[ 2 ], 0, 0 );
+    }
+
+    systemInit();
+    if (applicationInit( argv[ 1 ] ))
+    {
+        return 1;
+    }
+
+    for (count = 0; count < samples; count += BATCH)
+    {
+        if (applicationTask())
+        {
+            break;
+        }
+    }
+
+    if (adc7cap_close( &writer ))
+    {
+        printf( "Cannot write %s\n", argv[ 1 ] );
+        return 1;
+    }
+
+    query( argv[ 1 ] );
+
+    return 0;
+}
@@ -0,0 +1,208 @@
+/*
+Read and configure example for ADC_7 Click
+
+    Date          : Oct 2026.
+    Author        : MikroE FW Team
+
+Test configuration LINUX :
+
+    Host             : x86_64 / aarch64 Linux
+    HAL              : __HAL_LINUX.c (LTC2500 simulator, library/__adc7_sim.c)
+    Compiler         : gcc
+
+    gcc -O2 -I../../../library Click_ADC_7_LINUX_config.c ../../../library/__adc7_driver.c \
+        ../../../library/__adc7_sim.c -o Click_ADC_7_LINUX_config
+
+---
+
+Description :
+
+Scans through a list of configurations with adc7_readAndConfig. The SPI object of mikroBUS 1
+is wrapped by a spy which logs the bytes sent on SDI, so the frames can be checked.
+
+- New configuration - one 4-byte frame is sent, starting with the configuration word. The
+  device must be reprogrammed in that frame, the returned result must belong to the previous
+  configuration and the next conversion cycle must run under the new one.
+- Same configuration - 0x00 0x00 is sent instead of the configuration word and the device
+  is not reprogrammed.
+
+Exits with 1 if any check fails.
+
+*/
+
+#include <stdio.h>
+#include "__adc7_driver.h"
+#include "__adc7_sim.h"
+
+#define INPUT           1234.5
+#define LOG_SIZE        16
+#define STEPS           7
+
+typedef struct
+{
+    uint8_t gainConfig;
+    uint8_t downSampFactor;
+    uint8_t filterType;
+
+}T_config;
+
+T_config configs[ STEPS ];
+
+/* Configuration constants are not compile time constants, so the list is filled at run time */
+void addConfig( uint8_t step, uint8_t gainConfig, uint8_t downSampFactor, uint8_t filterType )
+{
+    configs[ step ].gainConfig = gainConfig;
+    configs[ step ].downSampFactor = downSampFactor;
+    configs[ step ].filterType = filterType;
+}
+
+T_adc7_ctx adc;
+
+uint8_t spiLog[ LOG_SIZE ];
+uint8_t spiLogLen;
+uint32_t errors;
+
+void spyWrite( unsigned int input )
+{
+    if (spiLogLen < LOG_SIZE)
+    {
+        spiLog[ spiLogLen++ ] = (uint8_t)input;
+    }
+
+    _MIKROBUS1_SPI.spiWrite( input );
+}
+
+unsigned int spyRead( unsigned int input )
+{
+    if (spiLogLen < LOG_SIZE)
+    {
+        spiLog[ spiLogLen++ ] = (uint8_t)input;
+    }
+
+    return _MIKROBUS1_SPI.spiRead( input );
+}
+
+const T_adc7sim_spiObj spySpi = { spyWrite, spyRead };
+
+void fail( const char *message, uint8_t step )
+{
+    if (errors++ < 10)
+    {
+        printf( "configuration %u : %s\n", step, message );
+    }
+}
+
+/* Blocking read of a full conversion cycle */
+int32_t convert( void )
+{
+    uint8_t buffData[ 4 ];
+
+    adc7_ctxStartConvCycle( &adc );
+    if (adc7_ctxWaitDataReady( &adc ) || adc7_ctxReadBytes( &adc, 4, buffData ))
+    {
+        errors++;
+        return 0;
+    }
+
+    return adc7_frameToCode( buffData );
+}
+
+int main()
+{
+    T_adc7sim_stats before;
+    T_adc7sim_stats after;
+    uint8_t cfg[ 2 ];
+    uint8_t step;
+    uint8_t changed;
+    int32_t expected;
+    int32_t code;
+
+    addConfig( 0, _ADC7_GAIN_DISABLE,  _ADC7_DOWNSAMPL_FACT_4,  _ADC7_AVERAGING_FILT );
+    addConfig( 1, _ADC7_GAIN_EXPAN_EN, _ADC7_DOWNSAMPL_FACT_16, _ADC7_AVERAGING_FILT );
+    addConfig( 2, _ADC7_GAIN_EXPAN_EN, _ADC7_DOWNSAMPL_FACT_16, _ADC7_AVERAGING_FILT );
+    addConfig( 3, _ADC7_GAIN_COMPR_EN, _ADC7_DOWNSAMPL_FACT_8,  _ADC7_SINC4_FILT );
+    addConfig( 4, _ADC7_GAIN_DISABLE,  _ADC7_DOWNSAMPL_FACT_32, _ADC7_SINC1_FILT );
+    addConfig( 5, _ADC7_GAIN_DISABLE,  _ADC7_DOWNSAMPL_FACT_32, _ADC7_SINC1_FILT );
+    addConfig( 6, _ADC7_GAIN_DISABLE,  _ADC7_DOWNSAMPL_FACT_4,  _ADC7_AVERAGING_FILT );
+
+    adc7sim_init();
+    adc7sim_setInput( 0, INPUT );
+
+    adc7_ctxSpiDriverInit( &adc, (T_ADC7_P)&_MIKROBUS1_GPIO, (T_ADC7_P)&spySpi );
+    adc7_ctxSetTimeout( &adc, 100000, 0 );
+    adc7_ctxSetConfig( &adc, configs[ 0 ].gainConfig, configs[ 0 ].downSampFactor, configs[ 0 ].filterType );
+
+    for (step = 1; step < STEPS; step++)
+    {
+        changed = (configs[ step ].gainConfig != configs[ step - 1 ].gainConfig) ||
+                  (configs[ step ].downSampFactor != configs[ step - 1 ].downSampFactor) ||
+                  (configs[ step ].filterType != configs[ step - 1 ].filterType);
+
+        // result of the cycle is produced under the previous configuration
+        expected = adc7sim_codeOf( 0, INPUT );
+        adc7_ctxStartConvCycle( &adc );
+        if (adc7_ctxWaitDataReady( &adc ))
+        {
+            fail( "no data ready", step );
+        }
+
+        adc7sim_getStats( 0, &before );
+        spiLogLen = 0;
+
+        if (adc7_ctxReadAndConfig( &adc, configs[ step ].gainConfig, configs[ step ].downSampFactor,
+                                   configs[ step ].filterType, &code ))
+        {
+            fail( "result not read", step );
+        }
+
+        adc7sim_getStats( 0, &after );
+        adc7sim_getConfig( 0, cfg );
+
+        if ((spiLogLen != 4) || (after.spiBytes - before.spiBytes != 4))
+        {
+            fail( "not a single 4-byte frame", step );
+        }
+        if (code != expected)
+        {
+            fail( "result not produced by the previous configuration", step );
+        }
+        if ((cfg[ 0 ] != adc.cfgShadow[ 0 ]) || (cfg[ 1 ] != adc.cfgShadow[ 1 ]))
+        {
+            fail( "device configuration differs from the driver", step );
+        }
+
+        if (changed)
+        {
+            if ((spiLog[ 0 ] != cfg[ 0 ]) || (spiLog[ 1 ] != cfg[ 1 ]))
+            {
+                fail( "configuration word not sent in the frame", step );
+            }
+            if (after.configWrites != before.configWrites + 1)
+            {
+                fail( "device not reprogrammed", step );
+            }
+        }
+        else
+        {
+            if (spiLog[ 0 ] || spiLog[ 1 ])
+            {
+                fail( "configuration word sent for an unchanged configuration", step );
+            }
+            if (after.configWrites != before.configWrites)
+            {
+                fail( "device reprogrammed for an unchanged configuration", step );
+            }
+        }
+
+        if (convert() != adc7sim_codeOf( 0, INPUT ))
+        {
+            fail( "next cycle not run under the new configuration", step );
+        }
+
+        printf( "configuration %u : %02X %02X sent, result %d\n", step, spiLog[ 0 ], spiLog[ 1 ], code );
+    }
+
+    printf( "%u errors\n", errors );
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,281 @@
+/*
+DMA readout example for ADC_7 Click
+
+    Date          : Oct 2026.
+    Author        : MikroE FW Team
+
+Test configuration LINUX :
+
+    Host             : x86_64 / aarch64 Linux
+    HAL              : __HAL_LINUX.c (LTC2500 simulator, library/__adc7_sim.c)
+    Compiler         : gcc
+
+    gcc -O2 -I../../../library Click_ADC_7_LINUX_dma.c ../../../library/__adc7_driver.c \
+        ../../../library/__adc7_sim.c -o Click_ADC_7_LINUX_dma
+
+---
+
+Description :
+
+Continuous capture into the DMA ping-pong buffers, BUSY, DRL and DMA complete interrupts
+come from the simulator. The input is a ramp, so every result must be larger than the previous one.
+
+- Streaming - buffers are processed and released as soon as they are full. Buffers must
+  alternate, frame trailers must be valid and timestamps must grow by one cycle per frame.
+- Overrun - one buffer is held for several buffer periods, every buffer completed meanwhile
+  must be counted in dmaOverruns.
+- Stop - adc7_ctxDmaStop is called in the middle of a cycle. The frame of that cycle must still
+  end up in the DMA buffer, nothing may reach the ring or the result callback and no new
+  cycle may be started. The capture may not be restarted while that frame is transferred.
+
+Exits with 1 if any check fails.
+
+*/
+
+#include <stdio.h>
+#include "__adc7_driver.h"
+#include "__adc7_sim.h"
+
+#define FRAMES          16
+#define FRAME_LEN       6
+#define BUFFERS         50
+#define HOLD_BUFFERS    5
+#define RING_SIZE       16
+#define TIME_LIMIT_NS   100000000ull
+
+T_adc7_ctx adc;
+uint8_t dmaBuf[ 2 ][ FRAMES * FRAME_LEN ];
+uint32_t dmaTicks[ 2 ][ FRAMES ];
+
+T_adc7_ring ring;
+int32_t ringBuf[ RING_SIZE ];
+
+uint32_t framesDone;
+uint32_t consumed;
+uint32_t callbacks;
+uint32_t errors;
+
+int32_t previousCode = (int32_t)0x80000000;
+uint32_t previousTick;
+uint32_t minSpacing = 0xFFFFFFFF;
+uint32_t maxSpacing;
+
+double rampInput( uint8_t slot, uint64_t timeNs )
+{
+    (void)slot;
+
+    return -2000.0 + timeNs * 1e-5;
+}
+
+void fail( const char *message, uint32_t value )
+{
+    if (errors++ < 10)
+    {
+        printf( "%s (%u)\n", message, value );
+    }
+}
+
+void busyIsr( void )
+{
+    adc7_ctxBusyIsr( &adc );
+}
+
+void drlIsr( void )
+{
+    adc7_ctxDrlIsr( &adc );
+}
+
+void dmaIsr( void )
+{
+    framesDone++;
+    adc7_ctxDmaIsr( &adc );
+}
+
+void onResult( T_adc7_ctx *ctx, int32_t result )
+{
+    (void)ctx;
+    (void)result;
+
+    callbacks++;
+}
+
+/* Checks and releases a full buffer, returns 0 if none is ready */
+uint8_t consumeBuffer( uint8_t checkOrder )
+{
+    static uint8_t *previousBuf;
+    T_adc7_sample sample;
+    uint8_t *buf;
+    uint32_t *ticks;
+    uint16_t frame;
+
+    buf = adc7_ctxDmaGetBuffer( &adc );
+    if (!buf)
+    {
+        return 0;
+    }
+
+    ticks = adc7_ctxDmaGetTicks( &adc );
+
+    if ((buf == previousBuf) || (ticks != dmaTicks[ buf == dmaBuf[ 1 ] ]))
+    {
+        fail( "buffers do not alternate", consumed );
+    }
+    previousBuf = buf;
+
+    for (frame = 0; frame < FRAMES; frame++)
+    {
+        if (adc7_decodeFrame( buf + frame * FRAME_LEN, &sample ) || (sample.downSampFactor != _ADC7_DOWNSAMPL_FACT_16))
+        {
+            fail( "wrong frame trailer", frame );
+        }
+
+        // frames dropped by an overrun break the sequence at the buffer start
+        if (checkOrder || frame)
+        {
+            if (sample.code <= previousCode)
+            {
+                fail( "results out of order", frame );
+            }
+            if ((int32_t)(ticks[ frame ] - previousTick) <= 0)
+            {
+                fail( "timestamps out of order", frame );
+            }
+            else
+            {
+                if (ticks[ frame ] - previousTick < minSpacing)
+                {
+                    minSpacing = ticks[ frame ] - previousTick;
+                }
+                if (ticks[ frame ] - previousTick > maxSpacing)
+                {
+                    maxSpacing = ticks[ frame ] - previousTick;
+                }
+            }
+        }
+
+        previousCode = sample.code;
+        previousTick = ticks[ frame ];
+    }
+
+    adc7_ctxDmaReleaseBuffer( &adc );
+    consumed++;
+
+    return 1;
+}
+
+int main()
+{
+    T_adc7sim_stats stats;
+    uint32_t framesAtStop;
+    uint32_t outputsAtStop;
+    uint64_t holdEnd;
+    uint8_t checkOrder = 0;
+
+    adc7sim_init();
+    adc7sim_setInputFn( 0, rampInput );
+
+    adc7_ctxSpiDriverInit( &adc, (T_ADC7_P)&_MIKROBUS1_GPIO, (T_ADC7_P)&_MIKROBUS1_SPI );
+    adc7_ctxSetConfig( &adc, _ADC7_GAIN_DISABLE, _ADC7_DOWNSAMPL_FACT_16, _ADC7_AVERAGING_FILT );
+    adc7_ctxSetTickSource( &adc, adc7sim_tick );
+
+    adc7_ctxDmaInit( &adc, adc7sim_dmaRead1, dmaBuf[ 0 ], dmaBuf[ 1 ], FRAMES, FRAME_LEN );
+    adc7_ctxDmaSetTicks( &adc, dmaTicks[ 0 ], dmaTicks[ 1 ] );
+    adc7_ringInit( &ring, ringBuf, RING_SIZE );
+    adc7_ctxAttachRing( &adc, &ring );
+    adc7_ctxSetResultCallback( &adc, onResult );
+
+    adc7sim_setIrq( 0, busyIsr, drlIsr );
+    adc7sim_setDmaIrq( 0, dmaIsr );
+
+    if (adc7_ctxDmaStart( &adc ))
+    {
+        fail( "capture not started", 0 );
+    }
+
+    // streaming
+    while ((consumed < BUFFERS) && (adc7sim_now() < TIME_LIMIT_NS))
+    {
+        adc7sim_delayNs( 1000 );
+        if (consumeBuffer( checkOrder ))
+        {
+            checkOrder = 1;
+        }
+    }
+
+    if ((consumed < BUFFERS) || adc.dmaOverruns)
+    {
+        fail( "buffers lost while streaming", adc.dmaOverruns );
+    }
+
+    printf( "streaming : %u buffers, frame spacing %u - %u ns\n", consumed, minSpacing, maxSpacing );
+
+    // overrun
+    while (!adc7_ctxDmaGetBuffer( &adc ) && (adc7sim_now() < TIME_LIMIT_NS))
+    {
+        adc7sim_delayNs( 1000 );
+    }
+
+    holdEnd = adc7sim_now() + (uint64_t)HOLD_BUFFERS * FRAMES * maxSpacing;
+    while (adc7sim_now() < holdEnd)
+    {
+        adc7sim_delayNs( 1000 );
+    }
+
+    if (adc.dmaOverruns < HOLD_BUFFERS - 1)
+    {
+        fail( "overruns not counted", adc.dmaOverruns );
+    }
+
+    consumeBuffer( 0 );
+
+    printf( "overrun : %u buffers dropped while holding one for %u buffer periods\n", adc.dmaOverruns, HOLD_BUFFERS );
+
+    // stop, half way through a cycle
+    while ((!adc.irqActive || (adc.irqPulses != 2)) && (adc7sim_now() < TIME_LIMIT_NS))
+    {
+        adc7sim_delayNs( 10 );
+    }
+
+    adc7sim_getStats( 0, &stats );
+    outputsAtStop = stats.outputs;
+    framesAtStop = framesDone;
+
+    adc7_ctxDmaStop( &adc );
+    while (adc.irqActive)
+    {
+        adc7sim_delayNs( 10 );
+    }
+
+    // the last frame is still being transferred
+    if (!adc.dmaCycle || !adc7_ctxDmaStart( &adc ))
+    {
+        fail( "capture restarted before the last frame was transferred", adc.dmaCycle );
+    }
+
+    adc7sim_delayNs( 100000 );
+    adc7sim_getStats( 0, &stats );
+
+    if ((framesDone != framesAtStop + 1) || (stats.outputs != outputsAtStop + 1))
+    {
+        fail( "last cycle not read into the DMA buffer", framesDone - framesAtStop );
+    }
+    if (adc.irqActive || adc.dmaCycle)
+    {
+        fail( "capture still active after stop", adc.irqActive );
+    }
+    if (callbacks || adc7_ringCount( &ring ))
+    {
+        fail( "DMA result delivered to the ring or callback", callbacks );
+    }
+
+    // every frame is in a consumed, ready or dropped buffer, or in the one being filled
+    if (framesDone != (consumed + adc.dmaReady + adc.dmaOverruns) * FRAMES + adc.dmaCount)
+    {
+        fail( "frames lost", framesDone );
+    }
+
+    printf( "stop : %u frames in total, %u after stop\n", framesDone, framesDone - framesAtStop );
+    printf( "%u errors\n", errors );
+
+    return errors ? 1 : 0;
+}
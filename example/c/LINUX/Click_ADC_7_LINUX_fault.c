@@ -0,0 +1,165 @@
+/*
+Fault recovery example for ADC_7 Click
+
+    Date          : Oct 2026.
+    Author        : MikroE FW Team
+
+Test configuration LINUX :
+
+    Host             : x86_64 / aarch64 Linux
+    HAL              : __HAL_LINUX.c (LTC2500 simulator, library/__adc7_sim.c)
+    Compiler         : gcc
+
+    gcc -O2 -I../../../library Click_ADC_7_LINUX_fault.c ../../../library/__adc7_driver.c \
+        ../../../library/__adc7_sim.c -o Click_ADC_7_LINUX_fault
+
+---
+
+Description :
+
+Injects wiring faults with adc7sim_setFault while the driver runs with a deadline and
+recovery enabled (adc7_setTimeout).
+
+- BUSY stuck high - adc7_startConvCycle must time out.
+- DRL stuck high - adc7_waitDataReady must time out.
+- MCK open - the device never converts, adc7_startConvCycle sees BUSY low and adc7_waitDataReady
+  must time out.
+- Non-blocking - adc7_poll must time out with BUSY stuck high.
+
+For each fault the wait must return _ADC7_TIMEOUT within the deadline (pin reads), recovery must
+pulse PRE once and restore the configuration written before, and once the fault is cleared the
+next conversion cycle must return the expected result.
+
+Exits with 1 if any check fails.
+
+*/
+
+#include <stdio.h>
+#include "__adc7_driver.h"
+#include "__adc7_sim.h"
+
+#define INPUT           -1500.25
+#define TIMEOUT_POLLS   2000
+
+#define WAIT_CYCLE      0
+#define WAIT_DRL        1
+#define WAIT_POLL       2
+
+T_adc7_ctx adc;
+
+uint32_t errors;
+
+void fail( const char *name, const char *message, uint32_t value )
+{
+    if (errors++ < 10)
+    {
+        printf( "%s : %s (%u)\n", name, message, value );
+    }
+}
+
+/* Runs the waits of one conversion cycle, stops at the first one which does not succeed */
+uint8_t runCycle( uint8_t *waitFailed, T_adc7sim_stats *before )
+{
+    uint8_t status;
+
+    adc7sim_getStats( 0, before );
+    status = adc7_ctxStartConvCycle( &adc );
+    if (status)
+    {
+        *waitFailed = WAIT_CYCLE;
+        return status;
+    }
+
+    adc7sim_getStats( 0, before );
+    *waitFailed = WAIT_DRL;
+
+    return adc7_ctxWaitDataReady( &adc );
+}
+
+uint8_t runPoll( T_adc7sim_stats *before )
+{
+    int32_t code;
+    uint8_t status;
+
+    adc7sim_getStats( 0, before );
+    adc7_ctxStartAcquisition( &adc );
+
+    do
+    {
+        status = adc7_ctxPoll( &adc, &code );
+    }
+    while (status == _ADC7_DATA_NOT_READY);
+
+    return status;
+}
+
+void checkFault( const char *name, uint8_t fault, uint8_t expectedWait )
+{
+    T_adc7sim_stats before;
+    T_adc7sim_stats after;
+    uint8_t buffData[ 4 ];
+    uint8_t cfg[ 2 ];
+    uint8_t waitFailed = WAIT_POLL;
+    uint8_t status;
+
+    adc7sim_setFault( 0, fault );
+
+    if (expectedWait == WAIT_POLL)
+    {
+        status = runPoll( &before );
+    }
+    else
+    {
+        status = runCycle( &waitFailed, &before );
+    }
+
+    adc7sim_getStats( 0, &after );
+    adc7sim_getConfig( 0, cfg );
+
+    if ((status != _ADC7_TIMEOUT) || (waitFailed != expectedWait))
+    {
+        fail( name, "wrong wait timed out", status );
+    }
+    if (after.gpioReads - before.gpioReads > TIMEOUT_POLLS)
+    {
+        fail( name, "deadline exceeded", after.gpioReads - before.gpioReads );
+    }
+    if (after.prePulses != before.prePulses + 1)
+    {
+        fail( name, "device not reset", after.prePulses - before.prePulses );
+    }
+    if ((cfg[ 0 ] != adc.cfgShadow[ 0 ]) || (cfg[ 1 ] != adc.cfgShadow[ 1 ]))
+    {
+        fail( name, "configuration not restored", cfg[ 0 ] );
+    }
+
+    adc7sim_setFault( 0, _ADC7SIM_FAULT_NONE );
+
+    if (adc7_ctxStartConvCycle( &adc ) || adc7_ctxWaitDataReady( &adc ) || adc7_ctxReadBytes( &adc, 4, buffData ))
+    {
+        fail( name, "no result after recovery", 0 );
+    }
+    else if (adc7_frameToCode( buffData ) != adc7sim_codeOf( 0, INPUT ))
+    {
+        fail( name, "wrong result after recovery", adc7_frameToCode( buffData ) );
+    }
+
+    printf( "%-14s : timed out after %u pin reads, %u errors\n", name, after.gpioReads - before.gpioReads, errors );
+}
+
+int main()
+{
+    adc7sim_init();
+    adc7sim_setInput( 0, INPUT );
+
+    adc7_ctxSpiDriverInit( &adc, (T_ADC7_P)&_MIKROBUS1_GPIO, (T_ADC7_P)&_MIKROBUS1_SPI );
+    adc7_ctxSetConfig( &adc, _ADC7_GAIN_EXPAN_EN, _ADC7_DOWNSAMPL_FACT_16, _ADC7_SINC4_FILT );
+    adc7_ctxSetTimeout( &adc, TIMEOUT_POLLS, 1 );
+
+    checkFault( "BUSY high", _ADC7SIM_FAULT_BUSY_HIGH, WAIT_CYCLE );
+    checkFault( "DRL high", _ADC7SIM_FAULT_DRL_HIGH, WAIT_DRL );
+    checkFault( "MCK open", _ADC7SIM_FAULT_MCK_OPEN, WAIT_DRL );
+    checkFault( "poll BUSY high", _ADC7SIM_FAULT_BUSY_HIGH, WAIT_POLL );
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,207 @@
+/*
+Extended frame example for ADC_7 Click
+
+    Date          : Oct 2026.
+    Author        : MikroE FW Team
+
+Test configuration LINUX :
+
+    Host             : x86_64 / aarch64 Linux
+    HAL              : __HAL_LINUX.c (LTC2500 simulator, library/__adc7_sim.c)
+    Compiler         : gcc
+
+    gcc -O2 -I../../../library Click_ADC_7_LINUX_frame.c ../../../library/__adc7_driver.c \
+        ../../../library/__adc7_sim.c -o Click_ADC_7_LINUX_frame
+
+---
+
+Description :
+
+Checks the configuration trailer of the 6-byte extended frame.
+
+- Decode - adc7_decodeFrame must accept a valid frame and return _ADC7_WRONG_FRAME for every
+  corrupted trailer : header bits, down sampling factor and filter type out of range, non-zero
+  padding bits.
+- Read - adc7_readSample reads through a SPI object which corrupts one chosen byte of the frame.
+  A corrupted header must be rejected with _ADC7_WRONG_FRAME, a trailer which decodes to another
+  valid configuration must be tagged as not current, and a clean frame must be tagged with the
+  active configuration and the expected result.
+
+Exits with 1 if any check fails.
+
+*/
+
+#include <stdio.h>
+#include "__adc7_driver.h"
+#include "__adc7_sim.h"
+
+#define INPUT           -432.1
+#define NO_CORRUPT      0xFF
+
+T_adc7_ctx adc;
+
+uint8_t corruptAt = NO_CORRUPT;
+uint8_t corruptMask;
+uint8_t byteIdx;
+uint32_t errors;
+
+void spyWrite( unsigned int input )
+{
+    _MIKROBUS1_SPI.spiWrite( input );
+}
+
+/* Flips corruptMask bits of the byte at corruptAt, counted from the start of the read */
+unsigned int spyRead( unsigned int input )
+{
+    unsigned int output = _MIKROBUS1_SPI.spiRead( input );
+
+    if (byteIdx++ == corruptAt)
+    {
+        output ^= corruptMask;
+    }
+
+    return output;
+}
+
+const T_adc7sim_spiObj spySpi = { spyWrite, spyRead };
+
+void fail( const char *message, uint8_t value )
+{
+    if (errors++ < 10)
+    {
+        printf( "%s (%02X)\n", message, value );
+    }
+}
+
+/* Decodes the valid frame with trailer byte idx replaced by value */
+uint8_t decodeWith( uint8_t idx, uint8_t value )
+{
+    uint8_t frame[ 6 ] = { 0x12, 0x34, 0x56, 0x78, 0x00, 0x00 };
+    T_adc7_sample sample;
+
+    frame[ 4 ] = 0x80 | (_ADC7_GAIN_EXPAN_EN << 4) | _ADC7_DOWNSAMPL_FACT_16;
+    frame[ 5 ] = _ADC7_SINC3_FILT << 4;
+    frame[ idx ] = value;
+
+    return adc7_decodeFrame( frame, &sample );
+}
+
+/* Reads one extended frame of a new conversion cycle, byte idx is corrupted with mask */
+uint8_t readCorrupted( uint8_t idx, uint8_t mask, T_adc7_sample *sample )
+{
+    uint8_t status;
+
+    adc7_ctxStartConvCycle( &adc );
+    if (adc7_ctxWaitDataReady( &adc ))
+    {
+        fail( "no data ready", idx );
+    }
+
+    byteIdx = 0;
+    corruptAt = idx;
+    corruptMask = mask;
+    status = adc7_ctxReadSample( &adc, sample );
+    corruptAt = NO_CORRUPT;
+
+    return status;
+}
+
+int main()
+{
+    T_adc7_sample sample;
+    uint8_t base4;
+    uint8_t base5;
+    uint8_t value;
+    uint8_t status;
+
+    base4 = 0x80 | (_ADC7_GAIN_EXPAN_EN << 4) | _ADC7_DOWNSAMPL_FACT_16;
+    base5 = _ADC7_SINC3_FILT << 4;
+
+    // decode
+    if (decodeWith( 4, base4 ))
+    {
+        fail( "valid frame rejected", base4 );
+    }
+    if (!decodeWith( 4, base4 & 0x7F ) || !decodeWith( 4, base4 | 0x40 ))
+    {
+        fail( "wrong header accepted", base4 );
+    }
+
+    for (value = 0; value < 16; value++)
+    {
+        status = decodeWith( 4, (base4 & 0xF0) | value );
+        if ((value < 2) || (value > 14))
+        {
+            if (status != _ADC7_WRONG_FRAME)
+            {
+                fail( "down sampling factor out of range accepted", value );
+            }
+        }
+        else if (status)
+        {
+            fail( "valid down sampling factor rejected", value );
+        }
+
+        status = decodeWith( 5, value << 4 );
+        if ((value < 1) || (value > 7))
+        {
+            if (status != _ADC7_WRONG_FRAME)
+            {
+                fail( "filter type out of range accepted", value );
+            }
+        }
+        else if (status)
+        {
+            fail( "valid filter type rejected", value );
+        }
+
+        if (value && (decodeWith( 5, base5 | value ) != _ADC7_WRONG_FRAME))
+        {
+            fail( "padding bits accepted", value );
+        }
+    }
+
+    printf( "decode : %u errors\n", errors );
+
+    // read
+    adc7sim_init();
+    adc7sim_setInput( 0, INPUT );
+
+    adc7_ctxSpiDriverInit( &adc, (T_ADC7_P)&_MIKROBUS1_GPIO, (T_ADC7_P)&spySpi );
+    adc7_ctxSetTimeout( &adc, 100000, 0 );
+    adc7_ctxSetConfig( &adc, _ADC7_GAIN_EXPAN_EN, _ADC7_DOWNSAMPL_FACT_16, _ADC7_SINC3_FILT );
+
+    if (readCorrupted( NO_CORRUPT, 0, &sample ))
+    {
+        fail( "clean frame rejected", 0 );
+    }
+    if ((sample.code != adc7sim_codeOf( 0, INPUT )) || (sample.gainConfig != _ADC7_GAIN_EXPAN_EN) ||
+        (sample.downSampFactor != _ADC7_DOWNSAMPL_FACT_16) || (sample.filterType != _ADC7_SINC3_FILT) ||
+        !sample.current)
+    {
+        fail( "clean frame decoded wrong", sample.downSampFactor );
+    }
+
+    if (readCorrupted( 4, 0x80, &sample ) != _ADC7_WRONG_FRAME)
+    {
+        fail( "corrupted header not rejected", 0x80 );
+    }
+    if (readCorrupted( 4, 0x0B, &sample ) != _ADC7_WRONG_FRAME)
+    {
+        fail( "corrupted down sampling factor not rejected", 0x0B );
+    }
+    if (readCorrupted( 5, 0x01, &sample ) != _ADC7_WRONG_FRAME)
+    {
+        fail( "corrupted padding not rejected", 0x01 );
+    }
+
+    // DF 16 -> DF 8 is still a valid trailer, but not the active configuration
+    if (readCorrupted( 4, 0x07, &sample ) || sample.current || (sample.downSampFactor != _ADC7_DOWNSAMPL_FACT_8))
+    {
+        fail( "foreign configuration tagged as current", sample.downSampFactor );
+    }
+
+    printf( "read : %u errors\n", errors );
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,209 @@
+/*
+Two click example for ADC_7 Click
+
+    Date          : Oct 2026.
+    Author        : MikroE FW Team
+
+Test configuration LINUX :
+
+    Host             : x86_64 / aarch64 Linux
+    HAL              : __HAL_LINUX.c (LTC2500 simulator, library/__adc7_sim.c)
+    Compiler         : gcc
+
+    gcc -O2 -I../../../library Click_ADC_7_LINUX_multi.c ../../../library/__adc7_driver.c \
+        ../../../library/__adc7_sim.c -o Click_ADC_7_LINUX_multi
+
+---
+
+Description :
+
+Drives two clicks (mikroBUS 1 and 2) with separate driver instances, different inputs and
+different configurations, and checks that every result comes from its own slot.
+
+- Interleaved - both conversion cycles are started before either result is read, the
+  configuration of the first click is changed every round.
+- Interrupt driven - every round starts an interrupt driven cycle of the second click, selects
+  both instances and reads the first one. The delay before the selects is swept over the cycle,
+  so the DRL interrupt of the second click is also taken inside the HAL remap of each select
+  (the Linux HAL charges the remap one access time), while the click being selected is
+  partly mapped.
+
+Exits with 1 on a wrong result or if no interrupt was taken inside a select.
+
+*/
+
+#include <stdio.h>
+#include "__adc7_driver.h"
+#include "__adc7_sim.h"
+
+#define INPUT_1         1234.5
+#define INPUT_2         -987.6
+#define ROUNDS_BLOCKING 200
+#define ROUNDS_IRQ      8000
+#define PHASE_SPAN      8000
+#define NO_SLOT         0xFF
+
+T_adc7_ctx adc1;
+T_adc7_ctx adc2;
+
+int32_t expected1;
+int32_t expected2;
+uint32_t errors;
+
+uint32_t irqResults;
+uint8_t selectSlot = NO_SLOT;
+uint32_t readsAtSelect;
+uint32_t midSelect[ 2 ];
+
+uint32_t gpioReads( uint8_t slot )
+{
+    T_adc7sim_stats stats;
+
+    adc7sim_getStats( slot, &stats );
+
+    return stats.gpioReads;
+}
+
+void check( const char *name, int32_t code, int32_t expected )
+{
+    if (code != expected)
+    {
+        if (errors++ < 10)
+        {
+            printf( "%s : code %d, expected %d\n", name, code, expected );
+        }
+    }
+}
+
+/* Blocking read of a cycle started earlier */
+int32_t finishCycle( T_adc7_ctx *ctx )
+{
+    uint8_t buffData[ 4 ];
+
+    if (adc7_ctxWaitDataReady( ctx ) || adc7_ctxReadBytes( ctx, 4, buffData ))
+    {
+        errors++;
+        return 0;
+    }
+
+    return adc7_frameToCode( buffData );
+}
+
+void onResult( T_adc7_ctx *ctx, int32_t result )
+{
+    if (ctx != &adc2)
+    {
+        errors++;
+    }
+
+    check( "irq click 2", result, expected2 );
+    irqResults++;
+}
+
+void busyIsr2( void )
+{
+    adc7_ctxBusyIsr( &adc2 );
+}
+
+/* No pin of the slot being selected was read yet, so the interrupt was taken inside its remap */
+void drlIsr2( void )
+{
+    if ((selectSlot != NO_SLOT) && (gpioReads( selectSlot ) == readsAtSelect))
+    {
+        midSelect[ selectSlot ]++;
+    }
+
+    adc7_ctxDrlIsr( &adc2 );
+}
+
+void selectBoth( void )
+{
+    selectSlot = 1;
+    readsAtSelect = gpioReads( 1 );
+    adc7_ctxCheckBusy( &adc2 );
+
+    selectSlot = 0;
+    readsAtSelect = gpioReads( 0 );
+    adc7_ctxCheckBusy( &adc1 );
+
+    selectSlot = NO_SLOT;
+}
+
+int main()
+{
+    uint8_t cfg[ 2 ];
+    uint32_t round;
+    int32_t code;
+
+    adc7sim_init();
+    adc7sim_setInput( 0, INPUT_1 );
+    adc7sim_setInput( 1, INPUT_2 );
+
+    adc7_ctxSpiDriverInit( &adc1, (T_ADC7_P)&_MIKROBUS1_GPIO, (T_ADC7_P)&_MIKROBUS1_SPI );
+    adc7_ctxSpiDriverInit( &adc2, (T_ADC7_P)&_MIKROBUS2_GPIO, (T_ADC7_P)&_MIKROBUS2_SPI );
+    adc7_ctxSetTimeout( &adc1, 100000, 0 );
+    adc7_ctxSetTimeout( &adc2, 100000, 0 );
+
+    adc7_ctxSetConfig( &adc2, _ADC7_GAIN_EXPAN_EN, _ADC7_DOWNSAMPL_FACT_4, _ADC7_AVERAGING_FILT );
+    expected2 = adc7sim_codeOf( 1, INPUT_2 );
+
+    for (round = 0; round < ROUNDS_BLOCKING; round++)
+    {
+        adc7_ctxSetConfig( &adc1, _ADC7_GAIN_DISABLE, (round & 1) ? _ADC7_DOWNSAMPL_FACT_8 : _ADC7_DOWNSAMPL_FACT_16,
+                           _ADC7_AVERAGING_FILT );
+        expected1 = adc7sim_codeOf( 0, INPUT_1 );
+
+        adc7_ctxStartConvCycle( &adc1 );
+        adc7_ctxStartConvCycle( &adc2 );
+        check( "click 1", finishCycle( &adc1 ), expected1 );
+        check( "click 2", finishCycle( &adc2 ), expected2 );
+
+        adc7sim_getConfig( 1, cfg );
+        if ((cfg[ 0 ] != adc2.cfgShadow[ 0 ]) || (cfg[ 1 ] != adc2.cfgShadow[ 1 ]))
+        {
+            errors++;
+        }
+    }
+
+    printf( "interleaved : %u rounds, %u errors\n", ROUNDS_BLOCKING, errors );
+
+    adc7_ctxSetConfig( &adc1, _ADC7_GAIN_DISABLE, _ADC7_DOWNSAMPL_FACT_16, _ADC7_AVERAGING_FILT );
+    expected1 = adc7sim_codeOf( 0, INPUT_1 );
+
+    adc7_ctxSetResultCallback( &adc2, onResult );
+    adc7sim_setIrq( 1, busyIsr2, drlIsr2 );
+
+    for (round = 0; round < ROUNDS_IRQ; round++)
+    {
+        adc7_ctxStartConvIrq( &adc2 );
+        adc7_ctxCheckBusy( &adc1 );
+
+        adc7sim_delayNs( round % PHASE_SPAN );
+        selectBoth();
+
+        if (adc7_ctxReadCodesBatch( &adc1, &code, 1 ))
+        {
+            errors++;
+        }
+        check( "click 1", code, expected1 );
+
+        while (adc2.irqActive)
+        {
+            adc7sim_delayNs( 100 );
+        }
+    }
+
+    adc7sim_setIrq( 1, 0, 0 );
+
+    printf( "interrupt driven : %u rounds, %u results of click 2, interrupts inside select %u (click 1) %u (click 2)\n",
+            ROUNDS_IRQ, irqResults, midSelect[ 0 ], midSelect[ 1 ] );
+    printf( "%u errors\n", errors );
+
+    if (!irqResults || !midSelect[ 0 ] || !midSelect[ 1 ])
+    {
+        printf( "interrupts were not taken inside a select\n" );
+        return 1;
+    }
+
+    return errors ? 1 : 0;
+}
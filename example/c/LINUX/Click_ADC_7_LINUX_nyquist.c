@@ -0,0 +1,216 @@
+/*
+Nyquist output example for ADC_7 Click
+
+    Date          : Oct 2026.
+    Author        : MikroE FW Team
+
+Test configuration LINUX :
+
+    Host             : x86_64 / aarch64 Linux
+    HAL              : __HAL_LINUX.c (LTC2500 simulator, library/__adc7_sim.c)
+    Compiler         : gcc
+
+    gcc -O2 -I../../../library Click_ADC_7_LINUX_nyquist.c ../../../library/__adc7_driver.c \
+        ../../../library/__adc7_sim.c -o Click_ADC_7_LINUX_nyquist
+
+---
+
+Description :
+
+Captures the 24-bit Nyquist words from SDOB next to the filtered result, in every mode
+which supports it : blocking (bit-banged MCK), interrupt driven, interrupt driven with a pulse
+train generator and non-blocking acquisition.
+
+- The number of words captured in a cycle must equal the number of MCK pulses the device
+  received in that cycle.
+- With a constant input and digital gain disabled, every word must match the upper 24 bits
+  of the filtered result.
+- With a buffer shorter than the cycle, the count must stop at the buffer size and the
+  memory after the buffer must not be written.
+
+Exits with 1 if any check fails.
+
+*/
+
+#include <stdio.h>
+#include "__adc7_driver.h"
+#include "__adc7_sim.h"
+
+#define INPUT           1234.5
+#define CYCLES          20
+#define NYQ_SIZE        64
+#define NYQ_SHORT       5
+#define GUARD           0x5A5A5A5A
+#define PULSE_RATE      200000
+
+#define MODE_BLOCKING   0
+#define MODE_IRQ        1
+#define MODE_TRAIN      2
+#define MODE_POLL       3
+
+const char *modeNames[] = { "blocking", "interrupt", "pulse train", "poll" };
+
+T_adc7_ctx adc;
+
+int32_t nyqBuf[ NYQ_SIZE + 1 ];
+volatile int32_t irqCode;
+volatile uint8_t irqDone;
+uint32_t errors;
+
+void fail( const char *message, uint8_t mode, uint32_t value )
+{
+    if (errors++ < 10)
+    {
+        printf( "%s : %s (%u)\n", modeNames[ mode ], message, value );
+    }
+}
+
+void busyIsr( void )
+{
+    adc7_ctxBusyIsr( &adc );
+}
+
+void drlIsr( void )
+{
+    adc7_ctxDrlIsr( &adc );
+}
+
+void onResult( T_adc7_ctx *ctx, int32_t result )
+{
+    (void)ctx;
+
+    irqCode = result;
+    irqDone = 1;
+}
+
+uint32_t mckPulses( void )
+{
+    T_adc7sim_stats stats;
+
+    adc7sim_getStats( 0, &stats );
+
+    return stats.mckPulses;
+}
+
+/* Runs one conversion cycle in the given mode, returns the filtered result */
+int32_t runCycle( uint8_t mode )
+{
+    uint8_t buffData[ 4 ];
+    int32_t code = 0;
+
+    switch (mode)
+    {
+        case MODE_BLOCKING :
+        {
+            adc7_ctxStartConvCycle( &adc );
+            if (adc7_ctxWaitDataReady( &adc ) || adc7_ctxReadBytes( &adc, 4, buffData ))
+            {
+                fail( "no result", mode, 0 );
+            }
+            code = adc7_frameToCode( buffData );
+            break;
+        }
+        case MODE_IRQ :
+        case MODE_TRAIN :
+        {
+            irqDone = 0;
+            adc7_ctxStartConvIrq( &adc );
+            while (!irqDone)
+            {
+                adc7sim_delayNs( 100 );
+            }
+            code = irqCode;
+            break;
+        }
+        default :
+        {
+            adc7_ctxStartAcquisition( &adc );
+            while (adc7_ctxPoll( &adc, &code ) == _ADC7_DATA_NOT_READY)
+            {
+                adc7sim_delayNs( 100 );
+            }
+            break;
+        }
+    }
+
+    return code;
+}
+
+void checkMode( uint8_t mode, uint8_t downSampFactor )
+{
+    uint32_t pulses;
+    uint16_t count;
+    uint16_t i;
+    int32_t code;
+    int32_t diff;
+    uint8_t cycle;
+
+    adc7_ctxSetPulseTrain( &adc, (mode == MODE_TRAIN) ? adc7sim_pulseTrain1 : 0, PULSE_RATE );
+    adc7_ctxSetConfig( &adc, _ADC7_GAIN_DISABLE, downSampFactor, _ADC7_AVERAGING_FILT );
+
+    for (cycle = 0; cycle < CYCLES; cycle++)
+    {
+        pulses = mckPulses();
+        code = runCycle( mode );
+        pulses = mckPulses() - pulses;
+        count = adc7_ctxGetNyquistCount( &adc );
+
+        if (count != pulses)
+        {
+            fail( "word count differs from MCK pulses", mode, count );
+        }
+
+        for (i = 0; i < count; i++)
+        {
+            diff = nyqBuf[ i ] - (code >> 8);
+            if ((diff > 1) || (diff < -1))
+            {
+                fail( "word differs from the filtered result", mode, i );
+            }
+        }
+    }
+
+    printf( "%s : DF code %u, %u words per cycle\n", modeNames[ mode ], downSampFactor, count );
+}
+
+int main()
+{
+    uint8_t mode;
+    uint16_t count;
+
+    adc7sim_init();
+    adc7sim_setInput( 0, INPUT );
+
+    adc7_ctxSpiDriverInit( &adc, (T_ADC7_P)&_MIKROBUS1_GPIO, (T_ADC7_P)&_MIKROBUS1_SPI );
+    adc7_ctxSetTimeout( &adc, 100000, 0 );
+    adc7_ctxSetResultCallback( &adc, onResult );
+    adc7sim_setIrq( 0, busyIsr, drlIsr );
+
+    adc7_ctxSetNyquist( &adc, adc7sim_nyquistRead1, nyqBuf, NYQ_SIZE );
+
+    for (mode = MODE_BLOCKING; mode <= MODE_POLL; mode++)
+    {
+        checkMode( mode, _ADC7_DOWNSAMPL_FACT_4 );
+        checkMode( mode, _ADC7_DOWNSAMPL_FACT_32 );
+    }
+
+    // buffer shorter than the cycle
+    for (mode = MODE_BLOCKING; mode <= MODE_POLL; mode++)
+    {
+        adc7_ctxSetNyquist( &adc, adc7sim_nyquistRead1, nyqBuf, NYQ_SHORT );
+        nyqBuf[ NYQ_SHORT ] = GUARD;
+
+        adc7_ctxSetPulseTrain( &adc, (mode == MODE_TRAIN) ? adc7sim_pulseTrain1 : 0, PULSE_RATE );
+        runCycle( mode );
+        count = adc7_ctxGetNyquistCount( &adc );
+
+        if ((count != NYQ_SHORT) || (nyqBuf[ NYQ_SHORT ] != GUARD))
+        {
+            fail( "capture not limited to the buffer size", mode, count );
+        }
+    }
+
+    printf( "%u errors\n", errors );
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,110 @@
+/*
+Example for ADC_7 Click - non-blocking acquisition
+
+    Date          : Oct 2026.
+    Author        : MikroE FW Team
+
+Test configuration LINUX :
+
+    Host             : x86_64 / aarch64 Linux
+    HAL              : __HAL_LINUX.c (LTC2500 simulator, library/__adc7_sim.c)
+    Compiler         : gcc
+
+    gcc -I../../../library Click_ADC_7_LINUX_poll.c ../../../library/__adc7_driver.c \
+        ../../../library/__adc7_sim.c -o Click_ADC_7_LINUX_poll
+
+---
+
+Description :
+
+The application is composed of three sections :
+
+- System Initialization - Initializes the simulator and sets the input voltage.
+- Application Initialization - Initializes SPI interface and performs configuration for conversion cycles.
+- Application Task - (code snippet) - Super loop which runs a control task every pass and advances
+  the acquisition with adc7_poll. A new conversion cycle is armed as soon as the previous result is read.
+  Results will be logged on standard output together with the number of control passes run
+  while the cycle was in progress.
+
+*/
+
+#include <stdio.h>
+#include "Click_ADC_7_types.h"
+#include "__adc7_driver.h"
+#include "__adc7_sim.h"
+
+int32_t microVolts;
+double inputVoltage = 1234.5;
+uint32_t controlPasses;
+
+void systemInit()
+{
+    adc7sim_init();
+    adc7sim_setInput( 0, inputVoltage );
+
+    printf( "Initializing...\n" );
+}
+
+void applicationInit()
+{
+    adc7_spiDriverInit( (T_ADC7_P)&_MIKROBUS1_GPIO, (T_ADC7_P)&_MIKROBUS1_SPI );
+    Delay_ms( 300 );
+
+    adc7_presetMode( _ADC7_LOW_STATE );
+    while (adc7_checkBusy() == _ADC7_DEVICE_IS_BUSY);
+    adc7_setConfig( _ADC7_GAIN_DISABLE, _ADC7_DOWNSAMPL_FACT_64, _ADC7_AVERAGING_FILT );
+    while (adc7_checkBusy() == _ADC7_DEVICE_IS_BUSY);
+
+    adc7_startAcquisition();
+
+    printf( "ADC 7 is initialized\n\n" );
+}
+
+/* Stands for communication and control work sharing the loop with the acquisition */
+void controlTask()
+{
+    controlPasses++;
+    Delay_1us();
+}
+
+uint8_t applicationTask()
+{
+    int32_t code;
+
+    controlTask();
+
+    if (adc7_poll( &code ) != _ADC7_DATA_IS_READY)
+    {
+        return 0;
+    }
+
+    adc7_startAcquisition();
+
+    microVolts = adc7_codeToMicroVolts( code );
+    printf( "Voltage:  %ld uV  (input %.1f mV, %lu control passes)\n", (long)microVolts, inputVoltage,
+            (unsigned long)controlPasses );
+    controlPasses = 0;
+
+    return 1;
+}
+
+int main()
+{
+    int count = 0;
+
+    systemInit();
+    applicationInit();
+
+    while (count < 10)
+    {
+        if (applicationTask())
+        {
+            count++;
+
+            inputVoltage -= 321.0;
+            adc7sim_setInput( 0, inputVoltage );
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,150 @@
+/*
+Example for ADC_7 Click - capture replay
+
+    Date          : Oct 2026.
+    Author        : MikroE FW Team
+
+Test configuration LINUX :
+
+    Host             : x86_64 / aarch64 Linux
+    HAL              : __HAL_LINUX.c (LTC2500 simulator, library/__adc7_sim.c) replaying a capture file
+    Compiler         : gcc
+
+    gcc -O2 -I../../../library Click_ADC_7_LINUX_replay.c ../../../library/__adc7_driver.c \
+        ../../../library/__adc7_sim.c ../../../library/__adc7_capture.c ../../../library/__adc7_replay.c \
+        -lm -o Click_ADC_7_LINUX_replay
+    ./Click_ADC_7_LINUX_replay capture.cap [fast | recorded]
+
+---
+
+Description :
+
+The application is composed of three sections :
+
+- System Initialization - Initializes the simulator and opens the capture (made by Click_ADC_7_LINUX_capture) as output of mikroBUS 1.
+- Application Initialization - Initializes SPI interface and performs the configuration recorded in the capture.
+- Application Task - (code snippet) - Reads batches of codes through the driver until the capture ends
+  and compares them with the recorded ones. Mismatching codes, replay counters, recorded and replayed
+  (virtual) duration and host throughput are logged on standard output.
+
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "Click_ADC_7_types.h"
+#include "__adc7_driver.h"
+#include "__adc7_sim.h"
+#include "__adc7_capture.h"
+#include "__adc7_replay.h"
+
+#define BATCH           256
+
+int32_t codes[ BATCH ];
+const T_adc7cap_reader *capture;
+uint64_t position;
+uint64_t errors;
+
+uint8_t systemInit( const char *path, uint8_t mode )
+{
+    adc7sim_init();
+
+    if (adc7replay_open( 0, path, mode ))
+    {
+        printf( "Cannot open %s\n", path );
+        return 1;
+    }
+
+    capture = adc7replay_capture( 0 );
+    printf( "Replaying %llu samples\n", (unsigned long long)capture->header->nSamples );
+
+    return 0;
+}
+
+void applicationInit()
+{
+    adc7_spiDriverInit( (T_ADC7_P)&_MIKROBUS1_GPIO, (T_ADC7_P)&_MIKROBUS1_SPI );
+    adc7_setTimeout( 1000000, 0 );
+
+    adc7_presetMode( _ADC7_LOW_STATE );
+    while (adc7_checkBusy() == _ADC7_DEVICE_IS_BUSY);
+    adc7_setConfig( capture->header->gainConfig, capture->header->downSampFactor, capture->header->filterType );
+    while (adc7_checkBusy() == _ADC7_DEVICE_IS_BUSY);
+}
+
+uint8_t applicationTask()
+{
+    uint64_t left = capture->header->nSamples - position;
+    uint16_t nCodes = (left < BATCH) ? (uint16_t)left : BATCH;
+    uint16_t count;
+
+    if (adc7_readCodesBatch( codes, nCodes ))
+    {
+        printf( "Timeout at sample %llu\n", (unsigned long long)position );
+        return 1;
+    }
+
+    for (count = 0; count < nCodes; count++)
+    {
+        if (codes[ count ] != capture->codes[ position + count ])
+        {
+            errors++;
+        }
+    }
+
+    position += nCodes;
+
+    return 0;
+}
+
+int main( int argc, char **argv )
+{
+    T_adc7replay_stats stats;
+    T_adc7cap_chunk summary;
+    struct timespec start;
+    struct timespec end;
+    uint8_t mode = _ADC7REPLAY_FAST;
+
+    if (argc < 2)
+    {
+        printf( "usage: %s capture.cap [fast | recorded]\n", argv[ 0 ] );
+        return 1;
+    }
+    if ((argc > 2) && !strcmp( argv[ 2 ], "recorded" ))
+    {
+        mode = _ADC7REPLAY_RECORDED;
+    }
+
+    if (systemInit( argv[ 1 ], mode ))
+    {
+        return 1;
+    }
+    applicationInit();
+
+    clock_gettime( CLOCK_MONOTONIC, &start );
+
+    while (position < capture->header->nSamples)
+    {
+        if (applicationTask())
+        {
+            break;
+        }
+    }
+
+    clock_gettime( CLOCK_MONOTONIC, &end );
+
+    adc7replay_getStats( 0, &stats );
+    adc7cap_summary( capture, 0, capture->header->nChunks, &summary );
+
+    printf( "%llu codes read, %llu differ, %llu late, %llu configuration mismatches\n",
+            (unsigned long long)position, (unsigned long long)errors,
+            (unsigned long long)stats.late, (unsigned long long)stats.mismatches );
+    printf( "recorded %.3f s, replayed %.3f s virtual, %.0f samples/s host\n",
+            capture->header->tickHz ? (double)(summary.tLast - summary.tFirst) / capture->header->tickHz : 0.0,
+            adc7sim_now() * 1e-9,
+            position / ((end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) * 1e-9) );
+
+    adc7replay_close( 0 );
+
+    return errors ? 1 : 0;
+}
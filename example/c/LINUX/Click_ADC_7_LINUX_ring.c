@@ -0,0 +1,172 @@
+/*
+Ring buffer example for ADC_7 Click
+
+    Date          : Oct 2026.
+    Author        : MikroE FW Team
+
+Test configuration LINUX :
+    
+    Host             : x86_64 / aarch64 Linux
+    HAL              : __HAL_LINUX.c (LTC2500 simulator, library/__adc7_sim.c)
+    Compiler         : gcc
+
+    gcc -O2 -pthread -I../../../library Click_ADC_7_LINUX_ring.c ../../../library/__adc7_driver.c \
+        ../../../library/__adc7_sim.c -o Click_ADC_7_LINUX_ring
+
+---
+
+Description :
+
+The acquisition thread stands in for the interrupt context : it runs the simulator, which calls
+adc7_busyIsr and adc7_drlIsr on BUSY and DRL falling edges, and the results are pushed to the sample ring.
+The main thread is the consumer, it pops the results and checks that no sample is lost or duplicated.
+The input voltage is a ramp, so every result must be larger than the previous one.
+
+- Streaming - the producer only runs the simulator while the ring is at most half full, at most
+  one result is produced per step, so no overrun is expected and every result must be consumed.
+- Overflow - with the consumer stopped, OVERFLOW results more than the ring capacity (RING_SIZE
+  entries) are produced. The ring must hold the oldest RING_SIZE results and count the rest as overruns.
+
+Exits with 1 if any check fails.
+
+*/
+
+#include <stdio.h>
+#include <pthread.h>
+#include <sched.h>
+#include "__adc7_driver.h"
+#include "__adc7_sim.h"
+
+#define RING_SIZE       64
+#define SAMPLES         100000
+#define OVERFLOW        16
+
+T_adc7_ring ring;
+int32_t ringBuf[ RING_SIZE ];
+volatile uint32_t produced;
+volatile uint32_t target;
+int32_t history[ RING_SIZE + OVERFLOW ];
+
+double rampInput( uint8_t slot, uint64_t timeNs )
+{
+    (void)slot;
+
+    return -2000.0 + timeNs * 1e-6;
+}
+
+void onResult( T_adc7_ctx *ctx, int32_t result )
+{
+    (void)ctx;
+
+    history[ produced % (RING_SIZE + OVERFLOW) ] = result;
+
+    if (++produced < target)
+    {
+        adc7_startConvIrq();
+    }
+}
+
+void *acquisitionTask( void *arg )
+{
+    (void)arg;
+
+    adc7_startConvIrq();
+
+    while (produced < target)
+    {
+        // the simulator runs faster than real time, wait for the consumer to make room
+        if (adc7_ringCount( &ring ) >= RING_SIZE / 2)
+        {
+            sched_yield();
+            continue;
+        }
+
+        adc7sim_delayNs( 500 );
+    }
+
+    return 0;
+}
+
+int main()
+{
+    pthread_t producer;
+    uint32_t consumed = 0;
+    uint32_t errors = 0;
+    uint32_t i;
+    int32_t previous = (int32_t)0x80000000;
+    int32_t code;
+
+    adc7sim_init();
+    adc7sim_setInputFn( 0, rampInput );
+    adc7_spiDriverInit( (T_ADC7_P)&_MIKROBUS1_GPIO, (T_ADC7_P)&_MIKROBUS1_SPI );
+    adc7_setConfig( _ADC7_GAIN_DISABLE, _ADC7_DOWNSAMPL_FACT_4, _ADC7_AVERAGING_FILT );
+
+    adc7_ringInit( &ring, ringBuf, RING_SIZE );
+    adc7_attachRing( &ring );
+    adc7_setResultCallback( onResult );
+    adc7sim_setIrq( 0, adc7_busyIsr, adc7_drlIsr );
+
+    // streaming
+    target = SAMPLES;
+    pthread_create( &producer, 0, acquisitionTask, 0 );
+
+    while ((consumed + ring.overruns) < SAMPLES)
+    {
+        if (adc7_ringPop( &ring, &code ))
+        {
+            sched_yield();
+            continue;
+        }
+
+        if (code <= previous)
+        {
+            errors++;
+        }
+        previous = code;
+        consumed++;
+    }
+
+    pthread_join( producer, 0 );
+
+    printf( "streaming : produced %u, consumed %u, overruns %u, ordering errors %u\n",
+            produced, consumed, ring.overruns, errors );
+
+    if ((consumed != SAMPLES) || ring.overruns)
+    {
+        printf( "results lost while streaming\n" );
+        errors++;
+    }
+
+    // overflow, the ring is empty and the producer is not throttled
+    produced = 0;
+    target = RING_SIZE + OVERFLOW;
+    ring.overruns = 0;
+
+    adc7_startConvIrq();
+    while (produced < target)
+    {
+        adc7sim_delayNs( 500 );
+    }
+
+    if ((adc7_ringCount( &ring ) != RING_SIZE) || (ring.overruns != OVERFLOW))
+    {
+        printf( "ring holds %u results, %u overruns, expected %u and %u\n",
+                adc7_ringCount( &ring ), ring.overruns, RING_SIZE, OVERFLOW );
+        errors++;
+    }
+
+    for (i = 0; i < RING_SIZE; i++)
+    {
+        if (adc7_ringPop( &ring, &code ) || (code != history[ i ]))
+        {
+            printf( "ring entry %u is not the result produced at that position\n", i );
+            errors++;
+            break;
+        }
+    }
+
+    printf( "overflow : %u results into a ring of %u, overruns %u\n", target, RING_SIZE, ring.overruns );
+    printf( "%u errors\n", errors );
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,121 @@
+/*
+Integer scaling check for ADC_7 Click
+
+    Date          : Oct 2026.
+    Author        : MikroE FW Team
+
+Test configuration LINUX :
+
+    Host             : x86_64 / aarch64 Linux
+    HAL              : __HAL_LINUX.c (LTC2500 simulator, library/__adc7_sim.c)
+    Compiler         : gcc
+
+    gcc -O2 -I../../../library Click_ADC_7_LINUX_scale.c ../../../library/__adc7_driver.c \
+        ../../../library/__adc7_sim.c -lm -o Click_ADC_7_LINUX_scale
+
+---
+
+Description :
+
+Sweeps the code range from the most negative to the most positive code for all four gain
+configurations and compares adc7_ctxCodeToMicroVolts and adc7_ctxCodeToNanoVolts with the
+same conversion done in double precision. Codes are stepped by SWEEP_STEP, with every code
+near zero and near both ends of the range included. Pass "full" as the argument to check
+every code (a few minutes). Exits with 1 if any result is more than 1 LSB (1 uV, 1 nV) off.
+
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "__adc7_driver.h"
+#include "__adc7_scale.h"
+#include "__adc7_sim.h"
+
+#define SWEEP_STEP      4099
+#define SWEEP_EDGE      65536
+
+T_adc7_ctx adc;
+
+double maxErrUv;
+double maxErrNv;
+uint32_t failures;
+
+void check( uint8_t gain, int32_t code )
+{
+    double valueLSB;
+    double nanoVolts;
+    double errUv;
+    double errNv;
+
+    valueLSB = (gain & _ADC7_GAIN_EXPAN_EN) ? 1073741823.0 : 2147483647.0;
+    nanoVolts = (double)code * _ADC7_VREF * 1000000.0 / valueLSB;
+    if (gain & _ADC7_GAIN_COMPR_EN)
+    {
+        nanoVolts *= 0.8;
+    }
+
+    errUv = fabs( adc7_ctxCodeToMicroVolts( &adc, code ) - nanoVolts / 1000.0 );
+    errNv = fabs( (double)adc7_ctxCodeToNanoVolts( &adc, code ) - nanoVolts );
+
+    if (errUv > maxErrUv)
+    {
+        maxErrUv = errUv;
+    }
+    if (errNv > maxErrNv)
+    {
+        maxErrNv = errNv;
+    }
+    if ((errUv > 1.0) || (errNv > 1.0))
+    {
+        if (failures++ < 10)
+        {
+            printf( "gain %u code %d : %d uV, %lld nV, expected %.3f nV\n", gain, code,
+                    adc7_ctxCodeToMicroVolts( &adc, code ),
+                    (long long)adc7_ctxCodeToNanoVolts( &adc, code ), nanoVolts );
+        }
+    }
+}
+
+int main( int argc, char **argv )
+{
+    int64_t step = SWEEP_STEP;
+    int64_t code;
+    uint64_t checked = 0;
+    uint8_t gain;
+
+    if ((argc > 1) && !strcmp( argv[ 1 ], "full" ))
+    {
+        step = 1;
+    }
+
+    adc7sim_init();
+    adc7_ctxSpiDriverInit( &adc, (T_ADC7_P)&_MIKROBUS1_GPIO, (T_ADC7_P)&_MIKROBUS1_SPI );
+
+    // disabled, expansion, compression, both
+    for (gain = 0; gain < 4; gain++)
+    {
+        adc7_ctxSetConfig( &adc, gain, _ADC7_DOWNSAMPL_FACT_4, _ADC7_AVERAGING_FILT );
+        maxErrUv = 0;
+        maxErrNv = 0;
+
+        for (code = INT32_MIN; code <= INT32_MAX; code += step)
+        {
+            check( gain, (int32_t)code );
+            checked++;
+        }
+        for (code = 0; code < SWEEP_EDGE; code++)
+        {
+            check( gain, (int32_t)(INT32_MIN + code) );
+            check( gain, (int32_t)(INT32_MAX - code) );
+            check( gain, (int32_t)(code - SWEEP_EDGE / 2) );
+            checked += 3;
+        }
+
+        printf( "gain %u : max error %.3f uV, %.3f nV\n", gain, maxErrUv, maxErrNv );
+    }
+
+    printf( "%llu codes checked, %u over 1 LSB\n", (unsigned long long)checked, failures );
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,268 @@
+/*
+Filter settling example for ADC_7 Click
+
+    Date          : Oct 2026.
+    Author        : MikroE FW Team
+
+Test configuration LINUX :
+
+    Host             : x86_64 / aarch64 Linux
+    HAL              : __HAL_LINUX.c (LTC2500 simulator, library/__adc7_sim.c)
+    Compiler         : gcc
+
+    gcc -O2 -I../../../library Click_ADC_7_LINUX_settle.c ../../../library/__adc7_driver.c \
+        ../../../library/__adc7_sim.c -o Click_ADC_7_LINUX_settle
+
+---
+
+Description :
+
+Checks the handling of unsettled outputs after a configuration write, for the sinc4 filter
+(3 unsettled outputs) and the flat passband filter (36 unsettled outputs). The counts are the
+ones of the driver settle table, the simulator settles every filter on its first output, so
+this checks how the driver applies the table, not the table values.
+
+- Blocking skip - a batch of results must take the unsettled outputs more conversion cycles.
+- Blocking flag - result reads must return _ADC7_DATA_NOT_SETTLED for the unsettled outputs only.
+- DMA skip - unsettled outputs must not reach the buffers.
+- DMA flag - every output must reach the buffers, the settled flags must mark the unsettled ones.
+
+Exits with 1 if any check fails.
+
+*/
+
+#include <stdio.h>
+#include "__adc7_driver.h"
+#include "__adc7_sim.h"
+
+#define INPUT           1234.5
+#define SAMPLES         8
+#define FRAMES          48
+#define FRAME_LEN       6
+
+T_adc7_ctx adc;
+
+uint8_t dmaBuf[ 2 ][ FRAMES * FRAME_LEN ];
+uint8_t dmaSettled[ 2 ][ FRAMES ];
+uint32_t framesDone;
+uint32_t errors;
+
+void fail( const char *message, uint8_t filterType, uint32_t value )
+{
+    if (errors++ < 10)
+    {
+        printf( "filter %u : %s (%u)\n", filterType, message, value );
+    }
+}
+
+void busyIsr( void )
+{
+    adc7_ctxBusyIsr( &adc );
+}
+
+void drlIsr( void )
+{
+    adc7_ctxDrlIsr( &adc );
+}
+
+void dmaIsr( void )
+{
+    framesDone++;
+    adc7_ctxDmaIsr( &adc );
+}
+
+uint32_t outputs( void )
+{
+    T_adc7sim_stats stats;
+
+    adc7sim_getStats( 0, &stats );
+
+    return stats.outputs;
+}
+
+/* Writes the filter, an averaging filter is written first so the configuration always changes */
+void writeFilter( uint8_t filterType, uint8_t unsettled )
+{
+    adc7_ctxSetConfig( &adc, _ADC7_GAIN_DISABLE, _ADC7_DOWNSAMPL_FACT_16, _ADC7_AVERAGING_FILT );
+    adc7_ctxSetConfig( &adc, _ADC7_GAIN_DISABLE, _ADC7_DOWNSAMPL_FACT_16, filterType );
+
+    if (adc7_ctxGetSettleCount( &adc ) != unsettled)
+    {
+        fail( "wrong settle count", filterType, adc7_ctxGetSettleCount( &adc ) );
+    }
+}
+
+void blockingSkip( uint8_t filterType, uint8_t unsettled )
+{
+    int32_t codes[ SAMPLES ];
+    uint32_t before;
+    uint8_t i;
+
+    adc7_ctxSetSettleMode( &adc, _ADC7_SETTLE_SKIP );
+    writeFilter( filterType, unsettled );
+
+    before = outputs();
+    if (adc7_ctxReadCodesBatch( &adc, codes, SAMPLES ))
+    {
+        fail( "batch failed", filterType, 0 );
+    }
+
+    if (outputs() - before != (uint32_t)(SAMPLES + unsettled))
+    {
+        fail( "wrong number of outputs skipped", filterType, outputs() - before - SAMPLES );
+    }
+    for (i = 0; i < SAMPLES; i++)
+    {
+        if (codes[ i ] != adc7sim_codeOf( 0, INPUT ))
+        {
+            fail( "wrong result", filterType, i );
+        }
+    }
+}
+
+void blockingFlag( uint8_t filterType, uint8_t unsettled )
+{
+    uint8_t buffData[ 4 ];
+    uint8_t status;
+    uint8_t i;
+
+    adc7_ctxSetSettleMode( &adc, _ADC7_SETTLE_FLAG );
+    writeFilter( filterType, unsettled );
+
+    for (i = 0; i < unsettled + SAMPLES; i++)
+    {
+        adc7_ctxStartConvCycle( &adc );
+        adc7_ctxWaitDataReady( &adc );
+        status = adc7_ctxReadBytes( &adc, 4, buffData );
+
+        if (status != ((i < unsettled) ? _ADC7_DATA_NOT_SETTLED : _ADC7_DATA_IS_READY))
+        {
+            fail( "wrong settled status", filterType, i );
+        }
+        if (adc7_ctxIsSettled( &adc ) != (i >= unsettled))
+        {
+            fail( "wrong settled flag", filterType, i );
+        }
+    }
+}
+
+/* Captures one full buffer, returns the settled flags of its frames */
+uint8_t* dmaCapture( uint8_t settleMode, uint8_t filterType, uint8_t unsettled )
+{
+    uint32_t before;
+    uint8_t *buf;
+    uint8_t *flags;
+    T_adc7_sample sample;
+    uint8_t i;
+
+    adc7_ctxSetSettleMode( &adc, settleMode );
+    writeFilter( filterType, unsettled );
+
+    adc7_ctxDmaInit( &adc, adc7sim_dmaRead1, dmaBuf[ 0 ], dmaBuf[ 1 ], FRAMES, FRAME_LEN );
+    adc7_ctxDmaSetSettleFlags( &adc, dmaSettled[ 0 ], dmaSettled[ 1 ] );
+
+    before = outputs();
+    framesDone = 0;
+    adc7_ctxDmaStart( &adc );
+
+    while (!adc7_ctxDmaGetBuffer( &adc ))
+    {
+        adc7sim_delayNs( 1000 );
+    }
+    adc7_ctxDmaStop( &adc );
+    while (adc.dmaCycle)
+    {
+        adc7sim_delayNs( 1000 );
+    }
+
+    buf = adc7_ctxDmaGetBuffer( &adc );
+    flags = adc7_ctxDmaGetSettleFlags( &adc );
+
+    if (outputs() - before != framesDone + ((settleMode == _ADC7_SETTLE_SKIP) ? unsettled : 0))
+    {
+        fail( "wrong number of outputs skipped", filterType, outputs() - before - framesDone );
+    }
+    if (adc7_ctxGetSettleCount( &adc ))
+    {
+        fail( "filter not settled after the capture", filterType, adc7_ctxGetSettleCount( &adc ) );
+    }
+
+    for (i = 0; i < FRAMES; i++)
+    {
+        if (adc7_decodeFrame( buf + i * FRAME_LEN, &sample ) || (sample.filterType != filterType))
+        {
+            fail( "wrong frame", filterType, i );
+        }
+        if (flags[ i ] && (sample.code != adc7sim_codeOf( 0, INPUT )))
+        {
+            fail( "settled frame with a wrong result", filterType, i );
+        }
+    }
+
+    adc7_ctxDmaReleaseBuffer( &adc );
+    adc7_ctxDmaInit( &adc, 0, 0, 0, 0, 0 );
+
+    return flags;
+}
+
+void dmaSkip( uint8_t filterType, uint8_t unsettled )
+{
+    uint8_t *flags;
+    uint8_t i;
+
+    flags = dmaCapture( _ADC7_SETTLE_SKIP, filterType, unsettled );
+
+    for (i = 0; i < FRAMES; i++)
+    {
+        if (!flags[ i ])
+        {
+            fail( "unsettled frame stored", filterType, i );
+        }
+    }
+}
+
+void dmaFlag( uint8_t filterType, uint8_t unsettled )
+{
+    uint8_t *flags;
+    uint8_t i;
+
+    flags = dmaCapture( _ADC7_SETTLE_FLAG, filterType, unsettled );
+
+    for (i = 0; i < FRAMES; i++)
+    {
+        if (flags[ i ] != (i >= unsettled))
+        {
+            fail( "wrong settled flag", filterType, i );
+        }
+    }
+}
+
+int main()
+{
+    uint8_t filterTypes[ 2 ];
+    uint8_t unsettled[ 2 ] = { 3, 36 };
+    uint8_t i;
+
+    filterTypes[ 0 ] = _ADC7_SINC4_FILT;
+    filterTypes[ 1 ] = _ADC7_FLAT_PASSBAND_FILT;
+
+    adc7sim_init();
+    adc7sim_setInput( 0, INPUT );
+
+    adc7_ctxSpiDriverInit( &adc, (T_ADC7_P)&_MIKROBUS1_GPIO, (T_ADC7_P)&_MIKROBUS1_SPI );
+    adc7_ctxSetTimeout( &adc, 100000, 0 );
+    adc7sim_setIrq( 0, busyIsr, drlIsr );
+    adc7sim_setDmaIrq( 0, dmaIsr );
+
+    for (i = 0; i < 2; i++)
+    {
+        blockingSkip( filterTypes[ i ], unsettled[ i ] );
+        blockingFlag( filterTypes[ i ], unsettled[ i ] );
+        dmaSkip( filterTypes[ i ], unsettled[ i ] );
+        dmaFlag( filterTypes[ i ], unsettled[ i ] );
+
+        printf( "filter %u : %u unsettled outputs, %u errors\n", filterTypes[ i ], unsettled[ i ], errors );
+    }
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,218 @@
+/*
+Instrumentation example for ADC_7 Click
+
+    Date          : Oct 2026.
+    Author        : MikroE FW Team
+
+Test configuration LINUX :
+
+    Host             : x86_64 / aarch64 Linux
+    HAL              : __HAL_LINUX.c (LTC2500 simulator, library/__adc7_sim.c)
+    Compiler         : gcc
+
+    gcc -O2 -D__ADC7_STATS__ -I../../../library Click_ADC_7_LINUX_stats.c ../../../library/__adc7_driver.c \
+        ../../../library/__adc7_sim.c -o Click_ADC_7_LINUX_stats
+
+---
+
+Description :
+
+Runs a mixed workload (blocking, read and configure, extended frames, Nyquist capture,
+interrupt driven and non-blocking cycles, a stuck DRL line) and checks the driver
+instrumentation counters against the pin and bus activity counted by the simulator.
+
+- mckPulses must equal the MCK pulses the device received.
+- busyPolls + drlPolls must equal the BUSY and DRL pin reads.
+- spiBytes must equal the bytes clocked on SDOA/SDI and SDOB, including DMA.
+- cfgWrites must equal the configuration words the device accepted.
+- notReady, busyRejects and timeouts must count the rejected calls made on purpose.
+
+Exits with 1 if any check fails.
+
+*/
+
+#ifndef __ADC7_STATS__
+#error "Build with -D__ADC7_STATS__"
+#endif
+
+#include <stdio.h>
+#include "__adc7_driver.h"
+#include "__adc7_sim.h"
+
+#define INPUT           1234.5
+#define CYCLES          10
+#define NYQ_SIZE        64
+#define FAULT_POLLS     1000
+#define DMA_FRAMES      4
+
+T_adc7_ctx adc;
+
+int32_t nyqBuf[ NYQ_SIZE ];
+uint8_t dmaBuf[ 2 ][ DMA_FRAMES * 4 ];
+volatile uint32_t irqResults;
+uint32_t errors;
+
+void busyIsr( void )
+{
+    adc7_ctxBusyIsr( &adc );
+}
+
+void drlIsr( void )
+{
+    adc7_ctxDrlIsr( &adc );
+}
+
+void dmaIsr( void )
+{
+    adc7_ctxDmaIsr( &adc );
+}
+
+void onResult( T_adc7_ctx *ctx, int32_t result )
+{
+    (void)ctx;
+    (void)result;
+
+    irqResults++;
+}
+
+void check( const char *name, uint32_t driver, uint32_t expected )
+{
+    printf( "%-12s : %u, expected %u\n", name, driver, expected );
+
+    if (driver != expected)
+    {
+        errors++;
+    }
+}
+
+void blockingCycle( void )
+{
+    uint8_t buffData[ 4 ];
+
+    adc7_ctxStartConvCycle( &adc );
+    if (adc7_ctxWaitDataReady( &adc ) || adc7_ctxReadBytes( &adc, 4, buffData ))
+    {
+        errors++;
+    }
+}
+
+int main()
+{
+    T_adc7sim_stats sim;
+    T_adc7_stats drv;
+    T_adc7_sample sample;
+    uint8_t buffData[ 4 ];
+    uint32_t expNotReady = 0;
+    uint32_t expBusyRejects = 0;
+    uint8_t cycle;
+    int32_t code;
+
+    adc7sim_init();
+    adc7sim_setInput( 0, INPUT );
+
+    adc7_ctxSpiDriverInit( &adc, (T_ADC7_P)&_MIKROBUS1_GPIO, (T_ADC7_P)&_MIKROBUS1_SPI );
+    adc7_ctxSetTimeout( &adc, 100000, 0 );
+    adc7_ctxSetResultCallback( &adc, onResult );
+    adc7sim_setIrq( 0, busyIsr, drlIsr );
+    adc7sim_setDmaIrq( 0, dmaIsr );
+
+    adc7_ctxSetConfig( &adc, _ADC7_GAIN_DISABLE, _ADC7_DOWNSAMPL_FACT_8, _ADC7_AVERAGING_FILT );
+
+    // blocking, read and configure, extended frames
+    for (cycle = 0; cycle < CYCLES; cycle++)
+    {
+        blockingCycle();
+
+        adc7_ctxStartConvCycle( &adc );
+        adc7_ctxWaitDataReady( &adc );
+        adc7_ctxReadAndConfig( &adc, _ADC7_GAIN_DISABLE, (cycle & 1) ? _ADC7_DOWNSAMPL_FACT_8 : _ADC7_DOWNSAMPL_FACT_16,
+                               _ADC7_AVERAGING_FILT, &code );
+
+        adc7_ctxStartConvCycle( &adc );
+        adc7_ctxWaitDataReady( &adc );
+        adc7_ctxReadSample( &adc, &sample );
+    }
+
+    // Nyquist capture
+    adc7_ctxSetNyquist( &adc, adc7sim_nyquistRead1, nyqBuf, NYQ_SIZE );
+    for (cycle = 0; cycle < CYCLES; cycle++)
+    {
+        blockingCycle();
+    }
+    adc7_ctxSetNyquist( &adc, 0, 0, 0 );
+
+    // interrupt driven, a second start is rejected while the cycle runs
+    for (cycle = 0; cycle < CYCLES; cycle++)
+    {
+        adc7_ctxStartConvIrq( &adc );
+        if (adc7_ctxStartConvIrq( &adc ) == _ADC7_DEVICE_IS_BUSY)
+        {
+            expBusyRejects++;
+        }
+        while (adc.irqActive)
+        {
+            adc7sim_delayNs( 100 );
+        }
+    }
+
+    // non-blocking
+    for (cycle = 0; cycle < CYCLES; cycle++)
+    {
+        adc7_ctxStartAcquisition( &adc );
+        while (adc7_ctxPoll( &adc, &code ) == _ADC7_DATA_NOT_READY)
+        {
+            adc7sim_delayNs( 100 );
+        }
+    }
+
+    // DMA
+    adc7_ctxDmaInit( &adc, adc7sim_dmaRead1, dmaBuf[ 0 ], dmaBuf[ 1 ], DMA_FRAMES, 4 );
+    adc7_ctxDmaStart( &adc );
+    while (!adc7_ctxDmaGetBuffer( &adc ))
+    {
+        adc7sim_delayNs( 1000 );
+    }
+    adc7_ctxDmaStop( &adc );
+    while (adc.dmaCycle)
+    {
+        adc7sim_delayNs( 1000 );
+    }
+    adc7_ctxDmaInit( &adc, 0, 0, 0, 0, 0 );
+
+    // data not ready, the result was already read
+    blockingCycle();
+    if (adc7_ctxReadBytes( &adc, 4, buffData ) == _ADC7_DATA_NOT_READY)
+    {
+        expNotReady++;
+    }
+
+    // DRL stuck high
+    adc7_ctxSetTimeout( &adc, FAULT_POLLS, 0 );
+    adc7sim_setFault( 0, _ADC7SIM_FAULT_DRL_HIGH );
+    adc7_ctxStartConvCycle( &adc );
+    adc7_ctxWaitDataReady( &adc );
+    adc7sim_setFault( 0, _ADC7SIM_FAULT_NONE );
+    adc7_ctxSetTimeout( &adc, 100000, 0 );
+    blockingCycle();
+
+    adc7_ctxGetStats( &adc, &drv );
+    adc7sim_getStats( 0, &sim );
+
+    check( "mckPulses", drv.mckPulses, sim.mckPulses );
+    check( "pin polls", drv.busyPolls + drv.drlPolls, sim.gpioReads );
+    check( "spiBytes", drv.spiBytes, sim.spiBytes + sim.nyqBytes + sim.dmaBytes );
+    check( "cfgWrites", drv.cfgWrites, sim.configWrites );
+    check( "notReady", drv.notReady, expNotReady );
+    check( "busyRejects", drv.busyRejects, expBusyRejects );
+    check( "timeouts", drv.timeouts, 1 );
+
+    if (!expNotReady || !expBusyRejects)
+    {
+        printf( "rejected calls were not made\n" );
+        errors++;
+    }
+
+    printf( "%u interrupt results, %u errors\n", irqResults, errors );
+
+    return errors ? 1 : 0;
+}
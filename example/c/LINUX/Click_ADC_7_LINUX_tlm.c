@@ -0,0 +1,134 @@
+/*
+Example for ADC_7 Click - binary telemetry
+
+    Date          : Oct 2026.
+    Author        : MikroE FW Team
+
+Test configuration LINUX :
+
+    Host             : x86_64 / aarch64 Linux
+    HAL              : __HAL_LINUX.c (LTC2500 simulator, library/__adc7_sim.c)
+    Compiler         : gcc
+
+    gcc -I../../../library Click_ADC_7_LINUX_tlm.c ../../../library/__adc7_driver.c \
+        ../../../library/__adc7_sim.c -lm -o Click_ADC_7_LINUX_tlm
+    ./Click_ADC_7_LINUX_tlm capture.bin [frames]
+
+---
+
+Description :
+
+The application is composed of three sections :
+
+- System Initialization - Initializes the simulator with a slow sine input and the virtual clock as timestamp source.
+- Application Initialization - Initializes SPI interface and performs configuration for conversion cycles.
+- Application Task - (code snippet) - Reads a batch of timestamped codes and writes it to the output
+  file as one telemetry frame (adc7_tlmFrame), where the MCU examples would write it to the log UART.
+  Byte counts of the binary stream and of the equivalent text log are reported on standard output.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "Click_ADC_7_types.h"
+#include "__adc7_driver.h"
+#include "__adc7_sim.h"
+
+#define BATCH           _ADC7_TLM_CODES_MAX
+#define FRAMES_DEF      100
+
+/* "Voltage:  " + LongToStr + "mV" + CRLF per sample */
+#define TEXT_BYTES      (10 + 11 + 2 + 2)
+
+int32_t codes[ BATCH ];
+uint32_t ticks[ BATCH ];
+uint8_t frame[ _ADC7_TLM_FRAME_MAX( BATCH ) ];
+FILE *output;
+unsigned long streamBytes;
+
+double sineInput( uint8_t slot, uint64_t timeNs )
+{
+    (void)slot;
+
+    return 1500.0 * sin( 2.0 * M_PI * 50.0 * timeNs * 1e-9 );
+}
+
+void systemInit()
+{
+    adc7sim_init();
+    adc7sim_setInputFn( 0, sineInput );
+
+    printf( "Initializing...\n" );
+}
+
+void applicationInit()
+{
+    adc7_spiDriverInit( (T_ADC7_P)&_MIKROBUS1_GPIO, (T_ADC7_P)&_MIKROBUS1_SPI );
+    adc7_setTickSource( adc7sim_tick );
+    adc7_setTimeout( 10000, 1 );
+
+    adc7_presetMode( _ADC7_LOW_STATE );
+    while (adc7_checkBusy() == _ADC7_DEVICE_IS_BUSY);
+    adc7_setConfig( _ADC7_GAIN_DISABLE, _ADC7_DOWNSAMPL_FACT_256, _ADC7_SINC4_FILT );
+    while (adc7_checkBusy() == _ADC7_DEVICE_IS_BUSY);
+
+    printf( "ADC 7 is initialized\n" );
+}
+
+uint8_t applicationTask()
+{
+    uint16_t frameLen;
+
+    if (adc7_readCodesBatchTs( codes, ticks, BATCH ))
+    {
+        printf( "Timeout\n" );
+        return 1;
+    }
+
+    frameLen = adc7_tlmFrame( codes, ticks, BATCH, frame );
+    fwrite( frame, 1, frameLen, output );
+    streamBytes += frameLen;
+
+    return 0;
+}
+
+int main( int argc, char **argv )
+{
+    unsigned long frames = FRAMES_DEF;
+    unsigned long count;
+
+    if (argc < 2)
+    {
+        printf( "usage: %s capture.bin [frames]\n", argv[ 0 ] );
+        return 1;
+    }
+    if (argc > 2)
+    {
+        frames = strtoul( argv[ 2 ], 0, 0 );
+    }
+
+    output = fopen( argv[ 1 ], "wb" );
+    if (!output)
+    {
+        return 1;
+    }
+
+    systemInit();
+    applicationInit();
+
+    for (count = 0; count < frames; count++)
+    {
+        if (applicationTask())
+        {
+            break;
+        }
+    }
+
+    fclose( output );
+
+    printf( "%lu samples, %lu bytes (%.2f bytes/sample), text log %lu bytes\n", count * BATCH, streamBytes,
+            (double)streamBytes / (count * BATCH), count * BATCH * TEXT_BYTES );
+
+    return 0;
+}
@@ -0,0 +1,11 @@
+#ifndef _ADC7_T_
+#define _ADC7_T_
+
+#include "stdint.h"
+
+#ifndef _ADC7_H_
+
+#define T_ADC7_P const uint8_t* 
+
+#endif
+#endif
\ No newline at end of file
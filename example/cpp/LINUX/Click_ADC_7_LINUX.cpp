@@ -0,0 +1,93 @@
+/*
+Example for ADC_7 Click - header-only C++ driver
+
+    Date          : Oct 2026.
+    Author        : MikroE FW Team
+
+Test configuration LINUX :
+
+    Host             : x86_64 / aarch64 Linux
+    HAL              : adc7::SimHal (LTC2500 simulator, library/__adc7_sim.c)
+    Compiler         : g++
+
+    gcc -c -I../../../library ../../../library/__adc7_sim.c -o __adc7_sim.o
+    g++ -I../../../library Click_ADC_7_LINUX.cpp __adc7_sim.o -o Click_ADC_7_LINUX -lpthread
+
+---
+
+Description :
+
+The application is composed of three sections :
+
+- System Initialization - Initializes the simulator and sets the input voltage.
+- Application Initialization - Initializes the driver pins (the global driver object does not touch
+  the HAL before init), resets the device and performs configuration for conversion cycles.
+- Application Task - (code snippet) - Runs a conversion cycle, reads the tagged result and converts
+  it to microvolts. Results will be logged on standard output.
+
+*/
+
+#include <stdio.h>
+#include "__adc7_driver.hpp"
+#include "__adc7_sim.hpp"
+
+adc7::Adc7< adc7::SimHal< 0 > > adc;
+double inputVoltage = 1234.5;
+
+void systemInit()
+{
+    adc7sim_init();
+    adc7sim_setInput( 0, inputVoltage );
+
+    printf( "Initializing...\n" );
+}
+
+void applicationInit()
+{
+    adc.init();
+    adc.setTimeout( 10000 );
+
+    adc.presetMode( adc7::LOW_STATE );
+    while (adc.checkBusy() == adc7::DEVICE_IS_BUSY);
+    adc.setConfig( adc7::GAIN_DISABLE, adc7::DOWNSAMPL_FACT_64, adc7::AVERAGING_FILT );
+    while (adc.checkBusy() == adc7::DEVICE_IS_BUSY);
+
+    printf( "ADC 7 is initialized\n\n" );
+}
+
+void applicationTask()
+{
+    adc7::Sample sample;
+
+    if (adc.startConvCycle() || adc.waitDataReady())
+    {
+        printf( "Timeout\n" );
+        return;
+    }
+    if (adc.readSample( &sample ))
+    {
+        printf( "Wrong frame\n" );
+        return;
+    }
+
+    printf( "Voltage:  %ld uV  (input %.1f mV, DF %u, filter %u)\n", (long)adc.codeToMicroVolts( sample.code ),
+            inputVoltage, sample.downSampFactor, sample.filterType );
+}
+
+int main()
+{
+    int count;
+
+    systemInit();
+    applicationInit();
+
+    for (count = 0; count < 10; count++)
+    {
+        applicationTask();
+
+        inputVoltage -= 321.0;
+        adc7sim_setInput( 0, inputVoltage );
+    }
+
+    return 0;
+}
@@ -0,0 +1,118 @@
+/*
+    __HAL_LINUX.c
+
+-----------------------------------------------------------------------------
+
+  This file is part of mikroSDK.
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+----------------------------------------------------------------------------- */
+
+/**
+@file   __HAL_LINUX.c
+@brief    Linux HAL backed by the ADC_7 simulator
+*/
+/* -------------------------------------------------------------------------- */
+
+#include "__adc7_sim.h"
+
+#ifdef __HAL_SPI__
+
+typedef void            (*T_hal_spiWriteFp)(unsigned int);
+typedef unsigned int    (*T_hal_spiReadFp)(unsigned int);
+
+typedef struct
+{
+    T_hal_spiWriteFp     spiWrite;
+    T_hal_spiReadFp      spiRead;
+
+}T_hal_spiObj;
+
+static T_hal_spiWriteFp  fp_spiWrite;
+static T_hal_spiReadFp   fp_spiRead;
+
+static void hal_spiMap(T_HAL_P spiObj)
+{
+    T_HAL_SPI_OBJ tmp = (T_HAL_SPI_OBJ)spiObj;
+
+    fp_spiWrite = tmp->spiWrite;
+    fp_spiRead  = tmp->spiRead;
+
+    // GPIO pointers are still those of the previous slot, interrupts taken here see a half mapped HAL
+    adc7sim_cpuAccess();
+}
+
+static void hal_spiWrite(uint8_t *pBuf, uint16_t nBytes)
+{
+    uint8_t *ptr = pBuf;
+
+    while (nBytes--)
+    {
+        fp_spiWrite( *( ptr++ ) );
+    }
+}
+
+static void hal_spiRead(uint8_t *pBuf, uint16_t nBytes)
+{
+    uint8_t *ptr = pBuf;
+
+    while (nBytes--)
+    {
+        *( ptr++ ) = fp_spiRead( 0x00 );
+    }
+}
+
+static void hal_spiTransfer(uint8_t *pIn, uint8_t *pOut, uint16_t nBytes)
+{
+    uint8_t *tmpIn  = pIn;
+    uint8_t *tmpOut = pOut;
+
+    while (nBytes--)
+    {
+        *( tmpOut++ ) = fp_spiRead( *( tmpIn++ ) );
+    }
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+/*
+  __HAL_LINUX.c
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+3. All advertising materials mentioning features or use of this software
+   must display the following acknowledgement:
+   This product includes software developed by the MikroElektonika.
+
+4. Neither the name of the MikroElektonika nor the
+   names of its contributors may be used to endorse or promote products
+   derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY MIKROELEKTRONIKA ''AS IS'' AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL MIKROELEKTRONIKA BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------------- */
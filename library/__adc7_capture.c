@@ -0,0 +1,502 @@
+/*
+    __adc7_capture.c
+
+-----------------------------------------------------------------------------
+
+  This file is part of mikroSDK.
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+----------------------------------------------------------------------------- */
+
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "__adc7_capture.h"
+#include "__adc7_scale.h"
+
+/* ------------------------------------------------------------------- MACROS */
+
+#define MAGIC           "ADC7CAP"
+#define HEADER_LEN      sizeof( T_adc7cap_header )
+#define INDEX_GROW      256
+#define COPY_BLOCK      4096
+
+/* ---------------------------------------------------------------- VARIABLES */
+
+static const struct
+{
+    float       voltRef;
+    uint32_t    valueLSB;
+    uint32_t    scaleUv;
+    uint64_t    scaleNv;
+
+} _gainCfg[ 4 ] = _ADC7_GAIN_CFG_INIT;
+
+/* -------------------------------------------- PRIVATE FUNCTION DECLARATIONS */
+
+static uint8_t _pushChunk( T_adc7cap_writer *writer );
+static uint8_t _copyTimes( T_adc7cap_writer *writer );
+static uint8_t _checkIndex( const T_adc7cap_reader *reader );
+static uint32_t _chunkOf( const T_adc7cap_reader *reader, uint64_t sample );
+static uint64_t _findInChunk( const T_adc7cap_reader *reader, uint32_t chunk, uint64_t time );
+
+/* --------------------------------------------- PRIVATE FUNCTION DEFINITIONS */
+
+static uint8_t _pushChunk( T_adc7cap_writer *writer )
+{
+    T_adc7cap_chunk *index;
+
+    if (writer->header.nChunks == writer->indexSize)
+    {
+        index = realloc( writer->index, (writer->indexSize + INDEX_GROW) * sizeof( T_adc7cap_chunk ) );
+        if (!index)
+        {
+            return _ADC7CAP_ERR_IO;
+        }
+
+        writer->index = index;
+        writer->indexSize += INDEX_GROW;
+    }
+
+    writer->index[ writer->header.nChunks++ ] = writer->chunk;
+    writer->chunk.count = 0;
+
+    return _ADC7CAP_OK;
+}
+
+static uint8_t _copyTimes( T_adc7cap_writer *writer )
+{
+    uint8_t block[ COPY_BLOCK ];
+    size_t len;
+
+    if (fflush( writer->timeFile ) || fseek( writer->timeFile, 0, SEEK_SET ))
+    {
+        return _ADC7CAP_ERR_IO;
+    }
+
+    while ((len = fread( block, 1, sizeof( block ), writer->timeFile )) > 0)
+    {
+        if (fwrite( block, 1, len, writer->file ) != len)
+        {
+            return _ADC7CAP_ERR_IO;
+        }
+    }
+
+    return ferror( writer->timeFile ) ? _ADC7CAP_ERR_IO : _ADC7CAP_OK;
+}
+
+/* Chunks must cover the samples in order, without gaps or overlaps */
+static uint8_t _checkIndex( const T_adc7cap_reader *reader )
+{
+    const T_adc7cap_chunk *chunk = reader->index;
+    uint64_t first = 0;
+    uint32_t count;
+
+    for (count = 0; count < reader->header->nChunks; count++, chunk++)
+    {
+        if ((chunk->first != first) || !chunk->count || (chunk->count > reader->header->chunkCodes))
+        {
+            return _ADC7CAP_ERR_FORMAT;
+        }
+
+        first += chunk->count;
+    }
+
+    return (first == reader->header->nSamples) ? _ADC7CAP_OK : _ADC7CAP_ERR_FORMAT;
+}
+
+/* Last chunk starting at or before sample */
+static uint32_t _chunkOf( const T_adc7cap_reader *reader, uint64_t sample )
+{
+    uint32_t low = 0;
+    uint32_t high = reader->header->nChunks;
+    uint32_t mid;
+
+    while (high - low > 1)
+    {
+        mid = low + (high - low) / 2;
+
+        if (reader->index[ mid ].first <= sample)
+        {
+            low = mid;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
+/* Sample times are non-decreasing, so the first one at or after time is found by bisection */
+static uint64_t _findInChunk( const T_adc7cap_reader *reader, uint32_t chunk, uint64_t time )
+{
+    const T_adc7cap_chunk *entry = &reader->index[ chunk ];
+    const uint32_t *times = reader->times + entry->first;
+    uint32_t low = 0;
+    uint32_t high = entry->count;
+    uint32_t mid;
+
+    while (low < high)
+    {
+        mid = low + (high - low) / 2;
+
+        if (entry->tFirst + times[ mid ] < time)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    return entry->first + low;
+}
+
+/* --------------------------------------------------------- PUBLIC FUNCTIONS */
+
+uint8_t adc7cap_open( T_adc7cap_writer *writer, const char *path, uint8_t gainConfig, uint8_t downSampFactor,
+                      uint8_t filterType, uint32_t chunkCodes, uint32_t tickHz )
+{
+    if ((gainConfig > 3) || (downSampFactor < 2) || (downSampFactor > 14) || (filterType < 1) || (filterType > 7))
+    {
+        return _ADC7CAP_ERR_PARAM;
+    }
+
+    memset( writer, 0, sizeof( T_adc7cap_writer ) );
+
+    memcpy( writer->header.magic, MAGIC, sizeof( MAGIC ) );
+    writer->header.version = _ADC7CAP_VERSION;
+    writer->header.headerLen = HEADER_LEN;
+    writer->header.gainConfig = gainConfig;
+    writer->header.downSampFactor = downSampFactor;
+    writer->header.filterType = filterType;
+    writer->header.vref = _ADC7_VREF;
+    writer->header.scaleUv = _gainCfg[ gainConfig ].scaleUv;
+    writer->header.scaleNv = _gainCfg[ gainConfig ].scaleNv;
+    writer->header.chunkCodes = chunkCodes ? chunkCodes : _ADC7CAP_CHUNK_CODES_DEF;
+    writer->header.tickHz = tickHz;
+
+    writer->file = fopen( path, "wb" );
+    if (!writer->file)
+    {
+        return _ADC7CAP_ERR_IO;
+    }
+
+    writer->timeFile = tmpfile();
+
+    // placeholder, completed by adc7cap_close
+    if (!writer->timeFile || (fwrite( &writer->header, HEADER_LEN, 1, writer->file ) != 1))
+    {
+        if (writer->timeFile)
+        {
+            fclose( writer->timeFile );
+        }
+        fclose( writer->file );
+        writer->file = 0;
+        writer->timeFile = 0;
+        return _ADC7CAP_ERR_IO;
+    }
+
+    return _ADC7CAP_OK;
+}
+
+uint8_t adc7cap_write( T_adc7cap_writer *writer, const int32_t *codes, const uint32_t *ticks, uint32_t nCodes )
+{
+    T_adc7cap_chunk *chunk = &writer->chunk;
+    uint64_t time;
+    uint32_t offset;
+    uint32_t count;
+
+    if (fwrite( codes, sizeof( int32_t ), nCodes, writer->file ) != nCodes)
+    {
+        return _ADC7CAP_ERR_IO;
+    }
+
+    for (count = 0; count < nCodes; count++)
+    {
+        if (ticks)
+        {
+            if (writer->header.nSamples && (ticks[ count ] < writer->tickLast))
+            {
+                writer->tickHigh += 0x100000000ULL;
+            }
+
+            writer->tickLast = ticks[ count ];
+            time = writer->tickHigh | ticks[ count ];
+        }
+        else
+        {
+            time = writer->header.nSamples;
+        }
+
+        if (chunk->count && ((chunk->count == writer->header.chunkCodes) || (time - chunk->tFirst > 0xFFFFFFFF)) &&
+            _pushChunk( writer ))
+        {
+            return _ADC7CAP_ERR_IO;
+        }
+
+        if (!chunk->count)
+        {
+            chunk->tFirst = time;
+            chunk->first = writer->header.nSamples;
+            chunk->sum = 0;
+            chunk->min = codes[ count ];
+            chunk->max = codes[ count ];
+        }
+
+        offset = (uint32_t)(time - chunk->tFirst);
+        if (fwrite( &offset, sizeof( uint32_t ), 1, writer->timeFile ) != 1)
+        {
+            return _ADC7CAP_ERR_IO;
+        }
+
+        chunk->tLast = time;
+        chunk->sum += codes[ count ];
+        chunk->count++;
+
+        if (codes[ count ] < chunk->min)
+        {
+            chunk->min = codes[ count ];
+        }
+        if (codes[ count ] > chunk->max)
+        {
+            chunk->max = codes[ count ];
+        }
+
+        writer->header.nSamples++;
+    }
+
+    return _ADC7CAP_OK;
+}
+
+uint8_t adc7cap_close( T_adc7cap_writer *writer )
+{
+    uint8_t status = _ADC7CAP_OK;
+
+    if (writer->chunk.count)
+    {
+        status = _pushChunk( writer );
+    }
+
+    writer->header.indexOffset = HEADER_LEN + writer->header.nSamples * (sizeof( int32_t ) + sizeof( uint32_t ));
+
+    if (!status)
+    {
+        if (_copyTimes( writer ) ||
+            (fwrite( writer->index, sizeof( T_adc7cap_chunk ), writer->header.nChunks, writer->file ) != writer->header.nChunks) ||
+            fseek( writer->file, 0, SEEK_SET ) ||
+            (fwrite( &writer->header, HEADER_LEN, 1, writer->file ) != 1))
+        {
+            status = _ADC7CAP_ERR_IO;
+        }
+    }
+
+    if (fclose( writer->file ))
+    {
+        status = _ADC7CAP_ERR_IO;
+    }
+    fclose( writer->timeFile );
+
+    free( writer->index );
+    writer->index = 0;
+    writer->file = 0;
+    writer->timeFile = 0;
+
+    return status;
+}
+
+uint8_t adc7cap_map( T_adc7cap_reader *reader, const char *path )
+{
+    const T_adc7cap_header *header;
+    struct stat st;
+    void *base;
+    int fd;
+
+    memset( reader, 0, sizeof( T_adc7cap_reader ) );
+
+    fd = open( path, O_RDONLY );
+    if (fd < 0)
+    {
+        return _ADC7CAP_ERR_IO;
+    }
+    if (fstat( fd, &st ) || (st.st_size < (off_t)HEADER_LEN))
+    {
+        close( fd );
+        return _ADC7CAP_ERR_FORMAT;
+    }
+
+    base = mmap( 0, st.st_size, PROT_READ, MAP_SHARED, fd, 0 );
+    close( fd );
+    if (base == MAP_FAILED)
+    {
+        return _ADC7CAP_ERR_IO;
+    }
+
+    header = (const T_adc7cap_header *)base;
+
+    if (memcmp( header->magic, MAGIC, sizeof( MAGIC ) ) || (header->version != _ADC7CAP_VERSION) ||
+        (header->headerLen != HEADER_LEN) || !header->chunkCodes || (header->nChunks > header->nSamples) ||
+        (header->indexOffset != HEADER_LEN + header->nSamples * (sizeof( int32_t ) + sizeof( uint32_t ))) ||
+        (header->indexOffset + (uint64_t)header->nChunks * sizeof( T_adc7cap_chunk ) > (uint64_t)st.st_size))
+    {
+        munmap( base, st.st_size );
+        return _ADC7CAP_ERR_FORMAT;
+    }
+
+    reader->base = (const uint8_t *)base;
+    reader->size = st.st_size;
+    reader->header = header;
+    reader->codes = (const int32_t *)(reader->base + HEADER_LEN);
+    reader->times = (const uint32_t *)(reader->codes + header->nSamples);
+    reader->index = (const T_adc7cap_chunk *)(reader->base + header->indexOffset);
+
+    if (_checkIndex( reader ))
+    {
+        adc7cap_unmap( reader );
+        return _ADC7CAP_ERR_FORMAT;
+    }
+
+    return _ADC7CAP_OK;
+}
+
+void adc7cap_unmap( T_adc7cap_reader *reader )
+{
+    if (reader->base)
+    {
+        munmap( (void *)reader->base, reader->size );
+    }
+
+    memset( reader, 0, sizeof( T_adc7cap_reader ) );
+}
+
+uint64_t adc7cap_sampleTime( const T_adc7cap_reader *reader, uint64_t sample )
+{
+    return reader->index[ _chunkOf( reader, sample ) ].tFirst + reader->times[ sample ];
+}
+
+uint64_t adc7cap_findTime( const T_adc7cap_reader *reader, uint64_t time )
+{
+    uint32_t low = 0;
+    uint32_t high = reader->header->nChunks;
+    uint32_t mid;
+
+    // first chunk ending at or after time
+    while (low < high)
+    {
+        mid = low + (high - low) / 2;
+
+        if (reader->index[ mid ].tLast < time)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    if (low == reader->header->nChunks)
+    {
+        return reader->header->nSamples;
+    }
+
+    return _findInChunk( reader, low, time );
+}
+
+const int32_t* adc7cap_range( const T_adc7cap_reader *reader, uint64_t tStart, uint64_t tEnd, uint64_t *nCodes )
+{
+    uint64_t first = adc7cap_findTime( reader, tStart );
+    uint64_t last = adc7cap_findTime( reader, tEnd );
+
+    *nCodes = (last > first) ? last - first : 0;
+
+    return reader->codes + first;
+}
+
+void adc7cap_summary( const T_adc7cap_reader *reader, uint32_t first, uint32_t count, T_adc7cap_chunk *summary )
+{
+    const T_adc7cap_chunk *chunk;
+
+    memset( summary, 0, sizeof( T_adc7cap_chunk ) );
+
+    if (first >= reader->header->nChunks)
+    {
+        return;
+    }
+    if (count > reader->header->nChunks - first)
+    {
+        count = reader->header->nChunks - first;
+    }
+
+    for (chunk = reader->index + first; count--; chunk++)
+    {
+        if (!summary->count)
+        {
+            summary->tFirst = chunk->tFirst;
+            summary->first = chunk->first;
+            summary->min = chunk->min;
+            summary->max = chunk->max;
+        }
+
+        summary->tLast = chunk->tLast;
+        summary->sum += chunk->sum;
+        summary->count += chunk->count;
+
+        if (chunk->min < summary->min)
+        {
+            summary->min = chunk->min;
+        }
+        if (chunk->max > summary->max)
+        {
+            summary->max = chunk->max;
+        }
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/*
+  __adc7_capture.c
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+3. All advertising materials mentioning features or use of this software
+   must display the following acknowledgement:
+   This product includes software developed by the MikroElektonika.
+
+4. Neither the name of the MikroElektonika nor the
+   names of its contributors may be used to endorse or promote products
+   derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY MIKROELEKTRONIKA ''AS IS'' AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL MIKROELEKTRONIKA BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------------- */
@@ -0,0 +1,279 @@
+/*
+    __adc7_capture.h
+
+-----------------------------------------------------------------------------
+
+  This file is part of mikroSDK.
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+----------------------------------------------------------------------------- */
+
+/**
+@file   __adc7_capture.h
+@brief    ADC_7 Capture Files
+*/
+/**
+@defgroup   ADC7_CAPTURE
+@brief      On-disk format for long raw code captures (Linux)
+@{
+
+| Global Library Prefix | **ADC7CAP**        |
+|:---------------------:|:------------------:|
+| Version               | **1.0.0**          |
+| Date                  | **Oct 2026.**      |
+| Developer             | **MikroE FW Team** |
+
+File layout, little endian :
+
+| Offset                  | Content                                                    |
+|:-----------------------:|:-----------------------------------------------------------|
+| 0                       | T_adc7cap_header (64 bytes)                                |
+| 64                      | Raw codes, int32_t, nSamples                               |
+| 64 + 4 * nSamples       | Sample times, uint32_t ticks since tFirst of their chunk   |
+| indexOffset             | T_adc7cap_chunk, nChunks (48 bytes)                        |
+
+Codes are stored contiguously, so any sample range is one pointer into the mapped file.
+The index gives time span, min, max and sum of every chunk, so the chunk containing a given
+time is found by binary search and overviews are computed without touching the codes.
+Timestamps are the 32-bit driver ticks extended to 64 bits. Every sample keeps its own time as
+an offset from the start of its chunk, so gaps and jitter are preserved. A chunk holds up to
+chunkCodes samples and ends early when an offset would not fit in 32 bits.
+The sample times, the index and the final header are written by adc7cap_close, a capture
+not closed has indexOffset 0 and is rejected by adc7cap_map.
+
+*/
+/* -------------------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <stddef.h>
+#include "stdint.h"
+
+#ifndef _ADC7_CAPTURE_H_
+#define _ADC7_CAPTURE_H_
+
+/** @defgroup ADC7_CAPTURE_VAR Variables */                   /** @{ */
+
+#define _ADC7CAP_VERSION                2
+#define _ADC7CAP_CHUNK_CODES_DEF        4096
+
+/** Status */
+#define _ADC7CAP_OK                     0
+#define _ADC7CAP_ERR_IO                 1
+#define _ADC7CAP_ERR_FORMAT             2
+#define _ADC7CAP_ERR_PARAM              3
+
+                                                                       /** @} */
+/** @defgroup ADC7_CAPTURE_TYPES Types */                     /** @{ */
+
+typedef struct
+{
+    char        magic[ 8 ];              /**< "ADC7CAP" */
+    uint16_t    version;
+    uint16_t    headerLen;
+    uint8_t     gainConfig;
+    uint8_t     downSampFactor;
+    uint8_t     filterType;
+    uint8_t     reserved0;
+    uint32_t    vref;                    /**< Reference voltage in mV */
+    uint32_t    scaleUv;                 /**< Scale constants of the gain configuration, see __adc7_scale.h */
+    uint64_t    scaleNv;
+    uint32_t    chunkCodes;              /**< Maximum samples per index chunk */
+    uint32_t    tickHz;                  /**< Tick rate, 0 - not known */
+    uint32_t    nChunks;
+    uint32_t    reserved1;
+    uint64_t    nSamples;
+    uint64_t    indexOffset;
+
+}T_adc7cap_header;
+
+typedef struct
+{
+    uint64_t    tFirst;                  /**< Extended tick of the first sample */
+    uint64_t    tLast;                   /**< Extended tick of the last sample */
+    int64_t     sum;
+    uint64_t    first;                   /**< Number of the first sample */
+    uint32_t    count;
+    int32_t     min;
+    int32_t     max;
+    uint32_t    reserved;
+
+}T_adc7cap_chunk;
+
+typedef struct
+{
+    FILE                *file;
+    FILE                *timeFile;       /**< Sample times, appended to the capture by adc7cap_close */
+    T_adc7cap_header    header;
+    T_adc7cap_chunk     *index;
+    uint32_t            indexSize;
+    T_adc7cap_chunk     chunk;           /**< Chunk being filled */
+    uint32_t            tickLast;
+    uint64_t            tickHigh;
+
+}T_adc7cap_writer;
+
+typedef struct
+{
+    const uint8_t           *base;
+    size_t                  size;
+    const T_adc7cap_header  *header;
+    const int32_t           *codes;
+    const uint32_t          *times;          /**< Sample time offsets from tFirst of their chunk */
+    const T_adc7cap_chunk   *index;
+
+}T_adc7cap_reader;
+
+                                                                       /** @} */
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/** @defgroup ADC7_CAPTURE_WRITE Writer */                    /** @{ */
+
+/**
+ * @brief Capture Open function
+ *
+ * @param[out] writer  Writer instance
+ * @param[in] path  File to create
+ * @param[in] gainConfig  Gain configuration of the capture
+ * @param[in] downSampFactor  Down sampling factor
+ * @param[in] filterType  Filter type
+ * @param[in] chunkCodes  Maximum samples per index chunk, 0 - _ADC7CAP_CHUNK_CODES_DEF
+ * @param[in] tickHz  Tick rate of the timestamps, 0 - not known
+ * @returns _ADC7CAP_OK, _ADC7CAP_ERR_PARAM or _ADC7CAP_ERR_IO
+ */
+uint8_t adc7cap_open( T_adc7cap_writer *writer, const char *path, uint8_t gainConfig, uint8_t downSampFactor,
+                      uint8_t filterType, uint32_t chunkCodes, uint32_t tickHz );
+
+/**
+ * @brief Capture Write function
+ *
+ * @param[in] writer  Writer instance
+ * @param[in] codes  Raw codes, as returned by adc7_readCodesBatch
+ * @param[in] ticks  Timestamps of the codes (adc7_readCodesBatchTs), 0 - sample number is used as time
+ * @param[in] nCodes  Number of codes
+ * @returns _ADC7CAP_OK or _ADC7CAP_ERR_IO
+ *
+ * Ticks may wrap, time between consecutive samples should be below 2^32 ticks.
+ */
+uint8_t adc7cap_write( T_adc7cap_writer *writer, const int32_t *codes, const uint32_t *ticks, uint32_t nCodes );
+
+/**
+ * @brief Capture Close function
+ *
+ * @param[in] writer  Writer instance
+ * @returns _ADC7CAP_OK or _ADC7CAP_ERR_IO
+ *
+ * Appends the sample times and the index, completes the header and closes the file.
+ */
+uint8_t adc7cap_close( T_adc7cap_writer *writer );
+
+                                                                       /** @} */
+/** @defgroup ADC7_CAPTURE_READ Reader */                     /** @{ */
+
+/**
+ * @brief Capture Map function
+ *
+ * @param[out] reader  Reader instance
+ * @param[in] path  Capture file
+ * @returns _ADC7CAP_OK, _ADC7CAP_ERR_IO or _ADC7CAP_ERR_FORMAT
+ *
+ * Maps the file read-only, header, codes and index are used in place.
+ */
+uint8_t adc7cap_map( T_adc7cap_reader *reader, const char *path );
+
+/**
+ * @brief Capture Unmap function
+ *
+ * @param[in] reader  Reader instance
+ */
+void adc7cap_unmap( T_adc7cap_reader *reader );
+
+/**
+ * @brief Sample Time function
+ *
+ * @param[in] reader  Reader instance
+ * @param[in] sample  Sample number
+ * @returns Extended tick of the sample
+ */
+uint64_t adc7cap_sampleTime( const T_adc7cap_reader *reader, uint64_t sample );
+
+/**
+ * @brief Time Find function
+ *
+ * @param[in] reader  Reader instance
+ * @param[in] time  Extended tick
+ * @returns Number of the first sample at or after time, nSamples if there is none
+ */
+uint64_t adc7cap_findTime( const T_adc7cap_reader *reader, uint64_t time );
+
+/**
+ * @brief Range function
+ *
+ * @param[in] reader  Reader instance
+ * @param[in] tStart  Start of the range (extended tick, inclusive)
+ * @param[in] tEnd  End of the range (extended tick, exclusive)
+ * @param[out] nCodes  Number of codes in the range
+ * @returns Pointer to the first code of the range in the mapped file
+ */
+const int32_t* adc7cap_range( const T_adc7cap_reader *reader, uint64_t tStart, uint64_t tEnd, uint64_t *nCodes );
+
+/**
+ * @brief Chunk Summary function
+ *
+ * @param[in] reader  Reader instance
+ * @param[in] first  First chunk
+ * @param[in] count  Number of chunks
+ * @param[out] summary  Memory where the merged time span, first sample, sum, count, min and max be stored
+ *
+ * Merges index entries only, codes are not read.
+ */
+void adc7cap_summary( const T_adc7cap_reader *reader, uint32_t first, uint32_t count, T_adc7cap_chunk *summary );
+
+                                                                       /** @} */
+#ifdef __cplusplus
+} // extern "C"
+#endif
+#endif
+                                                                       /** @} */
+/* -------------------------------------------------------------------------- */
+/*
+  __adc7_capture.h
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+3. All advertising materials mentioning features or use of this software
+   must display the following acknowledgement:
+   This product includes software developed by the MikroElektonika.
+
+4. Neither the name of the MikroElektonika nor the
+   names of its contributors may be used to endorse or promote products
+   derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY MIKROELEKTRONIKA ''AS IS'' AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL MIKROELEKTRONIKA BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------------- */
@@ -12,10 +12,37 @@
 ----------------------------------------------------------------------------- */
 
 #include "__adc7_driver.h"
+#include "__adc7_scale.h"
 #include "__adc7_hal.c"
 
 /* ------------------------------------------------------------------- MACROS */
 
+/*
+ * Orders ring buffer element accesses against the index update and HAL remapping against
+ * the active instance flags. buf[], ticks[] and the HAL pointers are not volatile, so the
+ * compiler must not move them across the barrier. Hosts (Linux simulator threads) need a
+ * full barrier. On mikroC targets, which are single core, a call through a volatile
+ * pointer is enough: the compiler cannot see the callee, so it keeps every memory access
+ * on its side of the call.
+ */
+#ifdef __GNUC__
+#define MEM_BARRIER()     __sync_synchronize()
+#else
+#define MEM_BARRIER()     _barrierFp()
+#endif
+
+/* Non-blocking acquisition states */
+#define ACQ_IDLE        0
+#define ACQ_PULSE       1
+#define ACQ_BUSY        2
+#define ACQ_DRL         3
+
+/* Instrumentation counters, compiled out unless __ADC7_STATS__ is defined */
+#ifdef __ADC7_STATS__
+#define STATS_ADD(ctx, field, n)    ((ctx)->stats.field += (n))
+#else
+#define STATS_ADD(ctx, field, n)
+#endif
 
 
 /* ---------------------------------------------------------------- VARIABLES */
@@ -24,11 +51,55 @@
 static uint8_t _slaveAddress;
 #endif
 
-#define VREF   4076
+#define VREF   _ADC7_VREF
+
+static const struct
+{
+    float       voltRef;
+    uint32_t    valueLSB;
+    uint32_t    scaleUv;
+    uint64_t    scaleNv;
+
+} _gainCfg[ 4 ] = _ADC7_GAIN_CFG_INIT;
+
+/*
+ * Unsettled outputs after filter synchronization, indexed by filter type - 1
+ * (sinc1, sinc2, sinc3, sinc4, ssinc, flat passband, averaging). Each value is the filter
+ * length in output periods minus one, from the LTC2500-32 data sheet filter lengths
+ * (sincN spans N output periods). Filter lengths scale with the down sampling factor,
+ * so counts in output periods do not depend on it. The simulator settles every filter on
+ * its first output, it checks how the driver applies these values, not the values.
+ */
+static const uint8_t _settleOutputs[ 7 ] = { 0, 1, 2, 3, 4, 36, 0 };
+
+/* MCK pulses per result, indexed by down sampling factor - 2 */
+static const uint16_t _numSampl[ 13 ] = _ADC7_NUM_SAMPL_INIT;
+
+/* CRC-16/CCITT-FALSE, one nibble per lookup */
+static const uint16_t _crcNibble[ 16 ] =
+{
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+/* Telemetry frame being encoded, codeIdx is the position of the open COBS code byte */
+typedef struct
+{
+    uint8_t     *out;
+    uint16_t    len;
+    uint16_t    codeIdx;
+    uint16_t    crc;
+
+} T_tlmEnc;
 
-static uint16_t numSampl;
-static float voltRef;
-static uint32_t valueLSB;
+#ifndef __GNUC__
+static void _barrier( void );
+static void (* volatile _barrierFp)( void ) = _barrier;
+#endif
+
+static T_adc7_ctx _defaultCtx;
+static T_adc7_ctx * volatile _activeCtx;
+static volatile uint8_t _remapping;
 
 const uint8_t _ADC7_SINC1_FILT                        = 0x01;
 const uint8_t _ADC7_SINC2_FILT                        = 0x02;
@@ -63,69 +134,101 @@ const uint8_t _ADC7_DEVICE_NOT_BUSY                   = 0x00;
 const uint8_t _ADC7_WRONG_GAIN_CONFIG                 = 0x02;
 const uint8_t _ADC7_WRONG_DOWNSAMPL_FACT              = 0x03;
 const uint8_t _ADC7_WRONG_FILT_TYPE                   = 0x04;
+const uint8_t _ADC7_WRONG_FRAME                       = 0x05;
+const uint8_t _ADC7_DATA_NOT_SETTLED                  = 0x06;
+const uint8_t _ADC7_ACQ_IDLE                          = 0x07;
+const uint8_t _ADC7_TIMEOUT                           = 0x08;
+
+const uint8_t _ADC7_SETTLE_OFF                        = 0x00;
+const uint8_t _ADC7_SETTLE_SKIP                       = 0x01;
+const uint8_t _ADC7_SETTLE_FLAG                       = 0x02;
 
 const uint8_t _ADC7_HIGH_STATE                        = 0x01;
 const uint8_t _ADC7_LOW_STATE                         = 0x00;
 
-/* -------------------------------------------- PRIVATE FUNCTION DECLARATIONS */
+const uint32_t _ADC7_MCK_RATE_MAX                     = 1000000;
 
+/* -------------------------------------------- PRIVATE FUNCTION DECLARATIONS */
 
+static void _select( T_adc7_ctx *ctx );
+static void _isrSelect( T_adc7_ctx *ctx );
+static void _remap( T_adc7_ctx *ctx );
+static uint8_t _makeConfig( T_adc7_ctx *ctx, uint8_t gainConfig, uint8_t downSampFactor, uint8_t filterType, uint8_t *cfg );
+static uint8_t _checkDataReady( void );
+static uint8_t _checkBusy( void );
+static void _setClock( uint8_t state );
+static uint8_t _readBytes( uint8_t nBytes, uint8_t *dataOut );
+static int32_t _toCode( uint8_t *buffData );
+static int32_t _toMicroVolts( T_adc7_ctx *ctx, int32_t code );
+static int64_t _toNanoVolts( T_adc7_ctx *ctx, int32_t code );
+static uint8_t _waitDrl( T_adc7_ctx *ctx );
+static uint8_t _waitBusy( T_adc7_ctx *ctx );
+static uint8_t _timeout( T_adc7_ctx *ctx );
+static void _recover( T_adc7_ctx *ctx );
+static uint8_t _convCycle( T_adc7_ctx *ctx );
+static uint8_t _readCode( T_adc7_ctx *ctx, int32_t *code );
+static void _nyqCapture( T_adc7_ctx *ctx );
+static uint8_t _settleStep( T_adc7_ctx *ctx );
+static void _stamp( T_adc7_ctx *ctx );
+static void _cobsPut( T_tlmEnc *enc, uint8_t input );
+static void _tlmPut( T_tlmEnc *enc, uint32_t value, uint8_t nBytes );
 
 /* --------------------------------------------- PRIVATE FUNCTION DEFINITIONS */
 
-
-
-/* --------------------------------------------------------- PUBLIC FUNCTIONS */
-
-#ifdef   __ADC7_DRV_SPI__
-
-void adc7_spiDriverInit(T_ADC7_P gpioObj, T_ADC7_P spiObj)
+#ifndef __GNUC__
+/* Called through _barrierFp by MEM_BARRIER */
+static void _barrier( void )
 {
-    hal_spiMap( (T_HAL_P)spiObj );
-    hal_gpioMap( (T_HAL_P)gpioObj );
-
-    hal_gpio_csSet( 1 );
-    hal_gpio_rstSet( 0 );
-    hal_gpio_pwmSet( 0 );
-    numSampl = 4;
-    voltRef = VREF;
-    valueLSB = 2147483647;
 }
-
 #endif
-#ifdef   __ADC7_DRV_I2C__
 
-void adc7_i2cDriverInit(T_ADC7_P gpioObj, T_ADC7_P i2cObj, uint8_t slave)
+/*
+ * HAL pin and SPI pointers are shared by all instances, so they are remapped only
+ * when a call switches to a different click.
+ */
+static void _select( T_adc7_ctx *ctx )
 {
-    _slaveAddress = slave;
-    hal_i2cMap( (T_HAL_P)i2cObj );
-    hal_gpioMap( (T_HAL_P)gpioObj );
-
-    // ... power ON
-    // ... configure CHIP
+    if (ctx != _activeCtx)
+    {
+        _remap( ctx );
+    }
 }
 
-#endif
-#ifdef   __ADC7_DRV_UART__
-
-void adc7_uartDriverInit(T_ADC7_P gpioObj, T_ADC7_P uartObj)
+/*
+ * ISR side select and restore. An interrupt taken in the middle of _remap finds the
+ * HAL partly mapped, so the whole mapping is rewritten then, even for the same click.
+ */
+static void _isrSelect( T_adc7_ctx *ctx )
 {
-    hal_uartMap( (T_HAL_P)uartObj );
-    hal_gpioMap( (T_HAL_P)gpioObj );
-
-    // ... power ON
-    // ... configure CHIP
+    if (_remapping || (ctx != _activeCtx))
+    {
+        _remap( ctx );
+    }
 }
 
-#endif
+/*
+ * _activeCtx is updated before the HAL pointers, so an interrupt restores the mapping
+ * of the click being selected, never the previous one.
+ */
+static void _remap( T_adc7_ctx *ctx )
+{
+    uint8_t remapping = _remapping;
 
-/* ----------------------------------------------------------- IMPLEMENTATION */
+    _remapping = 1;
+    _activeCtx = ctx;
+    MEM_BARRIER();
+    hal_spiMap( (T_HAL_P)ctx->spiObj );
+    hal_gpioMap( (T_HAL_P)ctx->gpioObj );
+    MEM_BARRIER();
+    _remapping = remapping;
+}
 
-uint8_t adc7_setConfig( uint8_t gainConfig, uint8_t downSampFactor, uint8_t filterType )
+/*
+ * Validates the configuration, encodes the configuration word into cfg and loads the
+ * conversion parameters of the next cycle. Returns 0 or wrong parameter status.
+ */
+static uint8_t _makeConfig( T_adc7_ctx *ctx, uint8_t gainConfig, uint8_t downSampFactor, uint8_t filterType, uint8_t *cfg )
 {
-    uint8_t tempData[ 2 ];
-    uint8_t count;
-    
     if (gainConfig > 3)
     {
         return _ADC7_WRONG_GAIN_CONFIG;
@@ -138,78 +241,41 @@ uint8_t adc7_setConfig( uint8_t gainConfig, uint8_t downSampFactor, uint8_t filt
     {
         return _ADC7_WRONG_FILT_TYPE;
     }
-    
-    numSampl = 1;
-    for (count = 0; count < downSampFactor; count++)
-    {
-        numSampl *= 2;
-    }
-    
-    switch (gainConfig)
-    {
-        case 0 :
-        {
-            voltRef = VREF;
-            valueLSB = 2147483647;
-        break;
-        }
-        case 1 :
-        {
-            voltRef = VREF;
-            valueLSB = 1073741823;
-        break;
-        }
-        case 2 :
-        {
-            voltRef = (float)VREF * 0.8;
-            valueLSB = 2147483647;
-        break;
-        }
-        case 3 :
-        {
-            voltRef = (float)VREF * 0.8;
-            valueLSB = 1073741823;
-        break;
-        }
-        default :
-        {
-        break;
-        }
-    }
-    
-    tempData[ 0 ] = 0x80;
-    tempData[ 0 ] |= gainConfig << 4;
-    tempData[ 0 ] |= downSampFactor;
-    tempData[ 1 ] = filterType << 4;
-    
-    if (adc7_checkBusy() == _ADC7_DEVICE_NOT_BUSY)
-    {
-        hal_gpio_csSet( 0 );
-        hal_spiWrite( tempData, 2 );
-        hal_gpio_csSet( 1 );
-    
-        return _ADC7_DEVICE_NOT_BUSY;
-    }
-    else
-    {
-        return _ADC7_DEVICE_IS_BUSY;
-    }
+
+    cfg[ 0 ] = 0x80;
+    cfg[ 0 ] |= gainConfig << 4;
+    cfg[ 0 ] |= downSampFactor;
+    cfg[ 1 ] = filterType << 4;
+
+    ctx->numSampl = _numSampl[ downSampFactor - 2 ];
+    ctx->voltRef = _gainCfg[ gainConfig ].voltRef;
+    ctx->valueLSB = _gainCfg[ gainConfig ].valueLSB;
+    ctx->scaleUv = _gainCfg[ gainConfig ].scaleUv;
+    ctx->scaleNv = _gainCfg[ gainConfig ].scaleNv;
+
+    return 0;
 }
 
-uint8_t adc7_checkDataReady( void )
+/* Every DRL low observation is timestamped, the last one before a read is the tick of its result */
+static uint8_t _checkDataReady( void )
 {
+    STATS_ADD( _activeCtx, drlPolls, 1 );
+
     if (hal_gpio_anGet())
     {
         return _ADC7_DATA_NOT_READY;
     }
     else
     {
+        _stamp( _activeCtx );
         return _ADC7_DATA_IS_READY;
     }
 }
 
-uint8_t adc7_checkBusy( void )
+static uint8_t _checkBusy( void )
 {
+    STATS_ADD( _activeCtx, busyPolls, 1 );
+
     if (hal_gpio_intGet())
     {
         return _ADC7_DEVICE_IS_BUSY;
@@ -220,10 +286,11 @@ uint8_t adc7_checkBusy( void )
     }
 }
 
-void adc7_setClock( uint8_t state )
+static void _setClock( uint8_t state )
 {
     if (state)
     {
+        STATS_ADD( _activeCtx, mckPulses, 1 );
         hal_gpio_pwmSet( 1 );
     }
     else
@@ -232,115 +299,1579 @@ void adc7_setClock( uint8_t state )
     }
 }
 
-void adc7_presetMode( uint8_t state )
+/* hal_spiRead clocks 0x00 on SDI, which keeps the active configuration */
+/* Null dataOut clocks the bytes out and discards them */
+static uint8_t _readBytes( uint8_t nBytes, uint8_t *dataOut )
 {
-    if (state)
+    uint8_t scratch[ 4 ];
+    uint16_t count;
+
+    if (_checkDataReady() == _ADC7_DATA_IS_READY)
     {
-        hal_gpio_rstSet( 1 );
+        hal_gpio_csSet( 0 );
+        if (dataOut)
+        {
+            hal_spiRead( dataOut, nBytes );
+        }
+        else
+        {
+            for (count = 0; count < nBytes; count += 4)
+            {
+                hal_spiRead( scratch, (nBytes - count < 4) ? nBytes - count : 4 );
+            }
+        }
+        hal_gpio_csSet( 1 );
+        STATS_ADD( _activeCtx, spiBytes, nBytes );
+        
+        return _ADC7_DATA_IS_READY;
     }
     else
     {
-        hal_gpio_rstSet( 0 );
+        STATS_ADD( _activeCtx, notReady, 1 );
+        return _ADC7_DATA_NOT_READY;
     }
 }
 
-uint8_t adc7_readBytes( uint8_t nBytes, uint8_t *dataOut )
+static int32_t _toCode( uint8_t *buffData )
 {
-    uint8_t tempData[ 256 ] = { 0 };
-    
-    if (adc7_checkDataReady() == _ADC7_DATA_IS_READY)
+    return _adc7_frameCode( buffData );
+}
+
+static int32_t _toMicroVolts( T_adc7_ctx *ctx, int32_t code )
+{
+    return _adc7_scaleUv( code, ctx->scaleUv );
+}
+
+static int64_t _toNanoVolts( T_adc7_ctx *ctx, int32_t code )
+{
+    return _adc7_scaleNv( code, ctx->scaleNv );
+}
+
+/* Bounded waits, ctx->timeout polls or forever if it is 0 */
+static uint8_t _waitDrl( T_adc7_ctx *ctx )
+{
+    uint32_t polls = ctx->timeout;
+
+    while (_checkDataReady())
     {
-        hal_gpio_csSet( 0 );
-        hal_spiTransfer( tempData, dataOut, nBytes );
-        hal_gpio_csSet( 1 );
-        
-        return _ADC7_DATA_IS_READY;
+        if (polls && !--polls)
+        {
+            return _timeout( ctx );
+        }
     }
-    else
+
+    return _ADC7_DATA_IS_READY;
+}
+
+static uint8_t _waitBusy( T_adc7_ctx *ctx )
+{
+    uint32_t polls = ctx->timeout;
+
+    while (_checkBusy())
     {
-        return _ADC7_DATA_NOT_READY;
+        if (polls && !--polls)
+        {
+            return _timeout( ctx );
+        }
+    }
+
+    return _ADC7_DEVICE_NOT_BUSY;
+}
+
+static uint8_t _timeout( T_adc7_ctx *ctx )
+{
+    STATS_ADD( ctx, timeouts, 1 );
+
+    if (ctx->recover)
+    {
+        _recover( ctx );
+    }
+
+    return _ADC7_TIMEOUT;
+}
+
+/*
+ * PRE pulse resets the digital filter and the configuration, the last configuration
+ * written by the driver is restored so the ctx conversion parameters stay valid.
+ */
+static void _recover( T_adc7_ctx *ctx )
+{
+    _setClock( 0 );
+    hal_gpio_csSet( 1 );
+
+    hal_gpio_rstSet( 1 );
+    Delay_1us();
+    hal_gpio_rstSet( 0 );
+    Delay_1us();
+
+    ctx->settleLeft = 0;
+    ctx->acqState = ACQ_IDLE;
+
+    if (ctx->cfgValid)
+    {
+        hal_gpio_csSet( 0 );
+        hal_spiWrite( ctx->cfgShadow, 2 );
+        hal_gpio_csSet( 1 );
+        STATS_ADD( ctx, spiBytes, 2 );
+        STATS_ADD( ctx, cfgWrites, 1 );
+
+        ctx->settleLeft = _settleOutputs[ (ctx->cfgShadow[ 1 ] >> 4) - 1 ];
     }
 }
 
-void adc7_startConvCycle( void )
+static uint8_t _convCycle( T_adc7_ctx *ctx )
 {
     uint16_t count;
-    
-    for (count = 0; count < numSampl; count++)
+
+    if (ctx->pulseTrain)
     {
-        adc7_setClock( 1 );
+        ctx->pulseTrain( ctx->numSampl, ctx->mckRate );
+        STATS_ADD( ctx, mckPulses, ctx->numSampl );
+
+        if (_waitDrl( ctx ))
+        {
+            return _ADC7_TIMEOUT;
+        }
+
+        return _ADC7_DATA_IS_READY;
+    }
+
+    ctx->nyqCount = 0;
+
+    for (count = 0; count < ctx->numSampl; count++)
+    {
+        _setClock( 1 );
         Delay_1us();
-        adc7_setClock( 0 );
+        _setClock( 0 );
         Delay_1us();
         
-        while (adc7_checkBusy());
+        if (_waitBusy( ctx ))
+        {
+            return _ADC7_TIMEOUT;
+        }
+
+        if (ctx->nyqRead)
+        {
+            _nyqCapture( ctx );
+        }
     }
+
+    return _ADC7_DATA_IS_READY;
 }
 
-uint8_t adc7_readResults( int16_t *voltage )
+/* Waits for DRL and reads the 32-bit result */
+static uint8_t _readCode( T_adc7_ctx *ctx, int32_t *code )
 {
-    int32_t voltData;
-    double temp;
     uint8_t buffData[ 4 ];
-    uint8_t checkReady;
-    
-    checkReady = adc7_readBytes( 4, buffData );
-    
-    if (checkReady)
+
+    if (_waitDrl( ctx ))
     {
-        return checkReady;
+        return _ADC7_TIMEOUT;
     }
-    
-    voltData = buffData[ 0 ];
-    voltData <<= 8;
-    voltData |= buffData[ 1 ];
-    voltData <<= 8;
-    voltData |= buffData[ 2 ];
-    voltData <<= 8;
-    voltData |= buffData[ 3 ];
-    
-    temp = (double)voltData / valueLSB;
-    temp *= voltRef;
-    *voltage = (int16_t)temp;
-    
-    return checkReady;
+
+    hal_gpio_csSet( 0 );
+    hal_spiRead( buffData, 4 );
+    hal_gpio_csSet( 1 );
+    STATS_ADD( ctx, spiBytes, 4 );
+
+    *code = _toCode( buffData );
+
+    return _ADC7_DATA_IS_READY;
 }
 
-/* -------------------------------------------------------------------------- */
-/*
-  __adc7_driver.c
+/* Accounts one result read, returns _ADC7_DATA_NOT_SETTLED only if settling mode is on */
+static uint8_t _settleStep( T_adc7_ctx *ctx )
+{
+    if (!ctx->settleLeft)
+    {
+        ctx->settled = 1;
 
-  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+        return _ADC7_DATA_IS_READY;
+    }
 
-  All rights reserved.
+    ctx->settleLeft--;
+    ctx->settled = 0;
 
-Redistribution and use in source and binary forms, with or without
-modification, are permitted provided that the following conditions are met:
+    if (ctx->settleMode == _ADC7_SETTLE_OFF)
+    {
+        return _ADC7_DATA_IS_READY;
+    }
 
-1. Redistributions of source code must retain the above copyright
-   notice, this list of conditions and the following disclaimer.
+    return _ADC7_DATA_NOT_SETTLED;
+}
 
-2. Redistributions in binary form must reproduce the above copyright
-   notice, this list of conditions and the following disclaimer in the
-   documentation and/or other materials provided with the distribution.
+static void _stamp( T_adc7_ctx *ctx )
+{
+    if (ctx->tick)
+    {
+        ctx->drlTick = ctx->tick();
+    }
+}
 
-3. All advertising materials mentioning features or use of this software
-   must display the following acknowledgement:
-   This product includes software developed by the MikroElektonika.
+/* Reads the 24-bit Nyquist word of the last conversion, words over nyqSize are dropped */
+static void _nyqCapture( T_adc7_ctx *ctx )
+{
+    uint8_t buffData[ 3 ];
+    int32_t nyqData;
 
-4. Neither the name of the MikroElektonika nor the
-   names of its contributors may be used to endorse or promote products
-   derived from this software without specific prior written permission.
+    if (ctx->nyqCount >= ctx->nyqSize)
+    {
+        return;
+    }
 
-THIS SOFTWARE IS PROVIDED BY MIKROELEKTRONIKA ''AS IS'' AND ANY
-EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
-WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-DISCLAIMED. IN NO EVENT SHALL MIKROELEKTRONIKA BE LIABLE FOR ANY
-DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
-(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
-LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
-ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
-(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
-SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+    ctx->nyqRead( buffData, 3 );
+    STATS_ADD( ctx, spiBytes, 3 );
+
+    nyqData = buffData[ 0 ];
+    nyqData <<= 8;
+    nyqData |= buffData[ 1 ];
+    nyqData <<= 8;
+    nyqData |= buffData[ 2 ];
+
+    if (nyqData & 0x00800000)
+    {
+        nyqData |= (int32_t)0xFF000000;
+    }
 
------------------------------------------------------------------------------ */
\ No newline at end of file
+    ctx->nyqBuf[ ctx->nyqCount++ ] = nyqData;
+}
+
+static void _cobsPut( T_tlmEnc *enc, uint8_t input )
+{
+    if (input)
+    {
+        enc->out[ enc->len++ ] = input;
+
+        if (enc->len - enc->codeIdx < 0xFF)
+        {
+            return;
+        }
+    }
+
+    // zero byte or 254 non-zero bytes close the block
+    enc->out[ enc->codeIdx ] = enc->len - enc->codeIdx;
+    enc->codeIdx = enc->len++;
+}
+
+/* Little endian field, included in the CRC */
+static void _tlmPut( T_tlmEnc *enc, uint32_t value, uint8_t nBytes )
+{
+    uint8_t input;
+
+    while (nBytes--)
+    {
+        input = (uint8_t)value;
+        value >>= 8;
+
+        enc->crc = (enc->crc << 4) ^ _crcNibble[ (enc->crc >> 12) ^ (input >> 4) ];
+        enc->crc = (enc->crc << 4) ^ _crcNibble[ (enc->crc >> 12) ^ (input & 0x0F) ];
+        _cobsPut( enc, input );
+    }
+}
+
+/* --------------------------------------------------------- PUBLIC FUNCTIONS */
+
+#ifdef   __ADC7_DRV_SPI__
+
+void adc7_spiDriverInit(T_ADC7_P gpioObj, T_ADC7_P spiObj)
+{
+    adc7_ctxSpiDriverInit( &_defaultCtx, gpioObj, spiObj );
+}
+
+void adc7_ctxSpiDriverInit(T_adc7_ctx *ctx, T_ADC7_P gpioObj, T_ADC7_P spiObj)
+{
+    ctx->gpioObj = gpioObj;
+    ctx->spiObj = spiObj;
+    _activeCtx = 0;
+    _select( ctx );
+
+    hal_gpio_csSet( 1 );
+    hal_gpio_rstSet( 0 );
+    hal_gpio_pwmSet( 0 );
+    ctx->numSampl = 4;
+    ctx->voltRef = VREF;
+    ctx->valueLSB = 2147483647;
+    ctx->scaleUv = _gainCfg[ 0 ].scaleUv;
+    ctx->scaleNv = _gainCfg[ 0 ].scaleNv;
+    ctx->cfgValid = 0;
+    ctx->acqState = ACQ_IDLE;
+    ctx->timeout = 0;
+    ctx->recover = 0;
+    ctx->irqPulses = 0;
+    ctx->irqActive = 0;
+    ctx->resultCb = 0;
+    ctx->ring = 0;
+    ctx->pulseTrain = 0;
+    ctx->mckRate = _ADC7_MCK_RATE_MAX;
+    ctx->dmaRead = 0;
+    ctx->dmaTicks[ 0 ] = 0;
+    ctx->dmaTicks[ 1 ] = 0;
+    ctx->dmaSettled[ 0 ] = 0;
+    ctx->dmaSettled[ 1 ] = 0;
+    ctx->dmaRun = 0;
+    ctx->dmaCycle = 0;
+    ctx->nyqRead = 0;
+    ctx->nyqCount = 0;
+    ctx->settleMode = _ADC7_SETTLE_OFF;
+    ctx->settleLeft = 0;
+    ctx->settled = 1;
+    ctx->tick = 0;
+    ctx->drlTick = 0;
+    ctx->tlmSeq = 0;
+#ifdef __ADC7_STATS__
+    adc7_ctxResetStats( ctx );
+#endif
+}
+
+#endif
+#ifdef   __ADC7_DRV_I2C__
+
+void adc7_i2cDriverInit(T_ADC7_P gpioObj, T_ADC7_P i2cObj, uint8_t slave)
+{
+    _slaveAddress = slave;
+    hal_i2cMap( (T_HAL_P)i2cObj );
+    hal_gpioMap( (T_HAL_P)gpioObj );
+
+    // ... power ON
+    // ... configure CHIP
+}
+
+#endif
+#ifdef   __ADC7_DRV_UART__
+
+void adc7_uartDriverInit(T_ADC7_P gpioObj, T_ADC7_P uartObj)
+{
+    hal_uartMap( (T_HAL_P)uartObj );
+    hal_gpioMap( (T_HAL_P)gpioObj );
+
+    // ... power ON
+    // ... configure CHIP
+}
+
+#endif
+
+/* ----------------------------------------------------------- IMPLEMENTATION */
+
+uint8_t adc7_setConfig( uint8_t gainConfig, uint8_t downSampFactor, uint8_t filterType )
+{
+    return adc7_ctxSetConfig( &_defaultCtx, gainConfig, downSampFactor, filterType );
+}
+
+uint8_t adc7_readAndConfig( uint8_t gainConfig, uint8_t downSampFactor, uint8_t filterType, int32_t *code )
+{
+    return adc7_ctxReadAndConfig( &_defaultCtx, gainConfig, downSampFactor, filterType, code );
+}
+
+uint8_t adc7_checkDataReady( void )
+{
+    return adc7_ctxCheckDataReady( &_defaultCtx );
+}
+
+uint8_t adc7_checkBusy( void )
+{
+    return adc7_ctxCheckBusy( &_defaultCtx );
+}
+
+void adc7_setClock( uint8_t state )
+{
+    adc7_ctxSetClock( &_defaultCtx, state );
+}
+
+void adc7_presetMode( uint8_t state )
+{
+    adc7_ctxPresetMode( &_defaultCtx, state );
+}
+
+uint8_t adc7_readBytes( uint8_t nBytes, uint8_t *dataOut )
+{
+    return adc7_ctxReadBytes( &_defaultCtx, nBytes, dataOut );
+}
+
+uint8_t adc7_startConvCycle( void )
+{
+    return adc7_ctxStartConvCycle( &_defaultCtx );
+}
+
+uint8_t adc7_readResults( int16_t *voltage )
+{
+    return adc7_ctxReadResults( &_defaultCtx, voltage );
+}
+
+uint8_t adc7_readCodesBatch( int32_t *codes, uint16_t nSamples )
+{
+    return adc7_ctxReadCodesBatch( &_defaultCtx, codes, nSamples );
+}
+
+uint8_t adc7_readResultsBatch( int32_t *microVolts, uint16_t nSamples )
+{
+    return adc7_ctxReadResultsBatch( &_defaultCtx, microVolts, nSamples );
+}
+
+uint8_t adc7_readCodesBatchTs( int32_t *codes, uint32_t *ticks, uint16_t nSamples )
+{
+    return adc7_ctxReadCodesBatchTs( &_defaultCtx, codes, ticks, nSamples );
+}
+
+uint8_t adc7_waitDataReady( void )
+{
+    return adc7_ctxWaitDataReady( &_defaultCtx );
+}
+
+void adc7_setTimeout( uint32_t polls, uint8_t recover )
+{
+    adc7_ctxSetTimeout( &_defaultCtx, polls, recover );
+}
+
+void adc7_setTickSource( T_adc7_tickFp tick )
+{
+    adc7_ctxSetTickSource( &_defaultCtx, tick );
+}
+
+uint32_t adc7_getTimestamp( void )
+{
+    return adc7_ctxGetTimestamp( &_defaultCtx );
+}
+
+uint8_t adc7_startAcquisition( void )
+{
+    return adc7_ctxStartAcquisition( &_defaultCtx );
+}
+
+uint8_t adc7_poll( int32_t *code )
+{
+    return adc7_ctxPoll( &_defaultCtx, code );
+}
+
+uint16_t adc7_tlmFrame( int32_t *codes, uint32_t *ticks, uint8_t nCodes, uint8_t *frame )
+{
+    return adc7_ctxTlmFrame( &_defaultCtx, codes, ticks, nCodes, frame );
+}
+
+#ifdef __ADC7_STATS__
+void adc7_getStats( T_adc7_stats *stats )
+{
+    adc7_ctxGetStats( &_defaultCtx, stats );
+}
+
+void adc7_resetStats( void )
+{
+    adc7_ctxResetStats( &_defaultCtx );
+}
+#endif
+
+uint8_t adc7_readResultsUv( int32_t *microVolts )
+{
+    return adc7_ctxReadResultsUv( &_defaultCtx, microVolts );
+}
+
+uint8_t adc7_readResultsNv( int64_t *nanoVolts )
+{
+    return adc7_ctxReadResultsNv( &_defaultCtx, nanoVolts );
+}
+
+int32_t adc7_codeToMicroVolts( int32_t code )
+{
+    return _toMicroVolts( &_defaultCtx, code );
+}
+
+int64_t adc7_codeToNanoVolts( int32_t code )
+{
+    return _toNanoVolts( &_defaultCtx, code );
+}
+
+void adc7_setPulseTrain( T_adc7_pulseTrainFp pulseTrain, uint32_t rate )
+{
+    adc7_ctxSetPulseTrain( &_defaultCtx, pulseTrain, rate );
+}
+
+void adc7_setResultCallback( T_adc7_resultFp resultCb )
+{
+    adc7_ctxSetResultCallback( &_defaultCtx, resultCb );
+}
+
+uint8_t adc7_startConvIrq( void )
+{
+    return adc7_ctxStartConvIrq( &_defaultCtx );
+}
+
+void adc7_busyIsr( void )
+{
+    adc7_ctxBusyIsr( &_defaultCtx );
+}
+
+void adc7_drlIsr( void )
+{
+    adc7_ctxDrlIsr( &_defaultCtx );
+}
+
+void adc7_attachRing( T_adc7_ring *ring )
+{
+    adc7_ctxAttachRing( &_defaultCtx, ring );
+}
+
+void adc7_ringInit( T_adc7_ring *ring, int32_t *buf, T_adc7_ringIdx size )
+{
+    ring->buf = buf;
+    ring->ticks = 0;
+    ring->mask = size - 1;
+    ring->head = 0;
+    ring->tail = 0;
+    ring->overruns = 0;
+}
+
+void adc7_ringSetTicks( T_adc7_ring *ring, uint32_t *ticks )
+{
+    ring->ticks = ticks;
+}
+
+uint8_t adc7_ringPush( T_adc7_ring *ring, int32_t code )
+{
+    return adc7_ringPushTs( ring, code, 0 );
+}
+
+uint8_t adc7_ringPushTs( T_adc7_ring *ring, int32_t code, uint32_t tick )
+{
+    T_adc7_ringIdx head = ring->head;
+
+    if ((T_adc7_ringIdx)(head - ring->tail) > ring->mask)
+    {
+        ring->overruns++;
+
+        return 1;
+    }
+
+    ring->buf[ head & ring->mask ] = code;
+    if (ring->ticks)
+    {
+        ring->ticks[ head & ring->mask ] = tick;
+    }
+    MEM_BARRIER();
+    ring->head = head + 1;
+
+    return 0;
+}
+
+uint8_t adc7_ringPop( T_adc7_ring *ring, int32_t *code )
+{
+    uint32_t tick;
+
+    return adc7_ringPopTs( ring, code, &tick );
+}
+
+uint8_t adc7_ringPopTs( T_adc7_ring *ring, int32_t *code, uint32_t *tick )
+{
+    T_adc7_ringIdx tail = ring->tail;
+
+    if (tail == ring->head)
+    {
+        return 1;
+    }
+
+    MEM_BARRIER();
+    *code = ring->buf[ tail & ring->mask ];
+    *tick = ring->ticks ? ring->ticks[ tail & ring->mask ] : 0;
+    MEM_BARRIER();
+    ring->tail = tail + 1;
+
+    return 0;
+}
+
+T_adc7_ringIdx adc7_ringCount( T_adc7_ring *ring )
+{
+    return (T_adc7_ringIdx)(ring->head - ring->tail);
+}
+
+void adc7_dmaInit( T_adc7_dmaReadFp dmaRead, uint8_t *buf0, uint8_t *buf1, uint16_t nFrames, uint8_t frameLen )
+{
+    adc7_ctxDmaInit( &_defaultCtx, dmaRead, buf0, buf1, nFrames, frameLen );
+}
+
+uint8_t adc7_dmaStart( void )
+{
+    return adc7_ctxDmaStart( &_defaultCtx );
+}
+
+void adc7_dmaStop( void )
+{
+    adc7_ctxDmaStop( &_defaultCtx );
+}
+
+void adc7_dmaIsr( void )
+{
+    adc7_ctxDmaIsr( &_defaultCtx );
+}
+
+void adc7_dmaSetTicks( uint32_t *ticks0, uint32_t *ticks1 )
+{
+    adc7_ctxDmaSetTicks( &_defaultCtx, ticks0, ticks1 );
+}
+
+void adc7_dmaSetSettleFlags( uint8_t *flags0, uint8_t *flags1 )
+{
+    adc7_ctxDmaSetSettleFlags( &_defaultCtx, flags0, flags1 );
+}
+
+uint32_t* adc7_dmaGetTicks( void )
+{
+    return adc7_ctxDmaGetTicks( &_defaultCtx );
+}
+
+uint8_t* adc7_dmaGetSettleFlags( void )
+{
+    return adc7_ctxDmaGetSettleFlags( &_defaultCtx );
+}
+
+uint8_t* adc7_dmaGetBuffer( void )
+{
+    return adc7_ctxDmaGetBuffer( &_defaultCtx );
+}
+
+void adc7_dmaReleaseBuffer( void )
+{
+    adc7_ctxDmaReleaseBuffer( &_defaultCtx );
+}
+
+int32_t adc7_frameToCode( uint8_t *frame )
+{
+    return _toCode( frame );
+}
+
+void adc7_setNyquist( T_adc7_nyqReadFp nyqRead, int32_t *buf, uint16_t size )
+{
+    adc7_ctxSetNyquist( &_defaultCtx, nyqRead, buf, size );
+}
+
+uint16_t adc7_getNyquistCount( void )
+{
+    return adc7_ctxGetNyquistCount( &_defaultCtx );
+}
+
+void adc7_setSettleMode( uint8_t mode )
+{
+    adc7_ctxSetSettleMode( &_defaultCtx, mode );
+}
+
+uint8_t adc7_getSettleCount( void )
+{
+    return adc7_ctxGetSettleCount( &_defaultCtx );
+}
+
+uint8_t adc7_isSettled( void )
+{
+    return adc7_ctxIsSettled( &_defaultCtx );
+}
+
+uint8_t adc7_readSample( T_adc7_sample *sample )
+{
+    return adc7_ctxReadSample( &_defaultCtx, sample );
+}
+
+/*
+ * Configuration trailer has the same layout as the configuration word:
+ * 1 0 DGC DGE DF[3:0], FILT[3:0] 0 0 0 0
+ */
+uint8_t adc7_decodeFrame( uint8_t *frame, T_adc7_sample *sample )
+{
+    if (_adc7_frameTrailer( frame, &sample->gainConfig, &sample->downSampFactor, &sample->filterType ))
+    {
+        return _ADC7_WRONG_FRAME;
+    }
+
+    sample->code = _toCode( frame );
+
+    return 0;
+}
+
+uint8_t adc7_ctxSetConfig( T_adc7_ctx *ctx, uint8_t gainConfig, uint8_t downSampFactor, uint8_t filterType )
+{
+    uint8_t tempData[ 2 ];
+    uint8_t status;
+
+    status = _makeConfig( ctx, gainConfig, downSampFactor, filterType, tempData );
+    if (status)
+    {
+        return status;
+    }
+
+    if (ctx->cfgValid && (ctx->cfgShadow[ 0 ] == tempData[ 0 ]) && (ctx->cfgShadow[ 1 ] == tempData[ 1 ]))
+    {
+        return _ADC7_DEVICE_NOT_BUSY;
+    }
+
+    _select( ctx );
+
+    if (_checkBusy() == _ADC7_DEVICE_NOT_BUSY)
+    {
+        hal_gpio_csSet( 0 );
+        hal_spiWrite( tempData, 2 );
+        hal_gpio_csSet( 1 );
+        STATS_ADD( ctx, spiBytes, 2 );
+        STATS_ADD( ctx, cfgWrites, 1 );
+
+        ctx->cfgShadow[ 0 ] = tempData[ 0 ];
+        ctx->cfgShadow[ 1 ] = tempData[ 1 ];
+        ctx->cfgValid = 1;
+        ctx->settleLeft = _settleOutputs[ filterType - 1 ];
+    
+        return _ADC7_DEVICE_NOT_BUSY;
+    }
+    else
+    {
+        STATS_ADD( ctx, busyRejects, 1 );
+
+        return _ADC7_DEVICE_IS_BUSY;
+    }
+}
+
+uint8_t adc7_ctxReadAndConfig( T_adc7_ctx *ctx, uint8_t gainConfig, uint8_t downSampFactor, uint8_t filterType, int32_t *code )
+{
+    uint8_t tempIn[ 4 ] = { 0 };
+    uint8_t tempOut[ 4 ];
+    uint8_t status;
+    uint8_t newCfg = 0;
+
+    _select( ctx );
+
+    if (_checkDataReady() == _ADC7_DATA_NOT_READY)
+    {
+        STATS_ADD( ctx, notReady, 1 );
+
+        return _ADC7_DATA_NOT_READY;
+    }
+
+    status = _makeConfig( ctx, gainConfig, downSampFactor, filterType, tempIn );
+    if (status)
+    {
+        return status;
+    }
+
+    if (ctx->cfgValid && (ctx->cfgShadow[ 0 ] == tempIn[ 0 ]) && (ctx->cfgShadow[ 1 ] == tempIn[ 1 ]))
+    {
+        tempIn[ 0 ] = 0x00;
+        tempIn[ 1 ] = 0x00;
+    }
+    else
+    {
+        ctx->cfgShadow[ 0 ] = tempIn[ 0 ];
+        ctx->cfgShadow[ 1 ] = tempIn[ 1 ];
+        ctx->cfgValid = 1;
+        newCfg = 1;
+        STATS_ADD( ctx, cfgWrites, 1 );
+    }
+
+    hal_gpio_csSet( 0 );
+    hal_spiTransfer( tempIn, tempOut, 4 );
+    hal_gpio_csSet( 1 );
+    STATS_ADD( ctx, spiBytes, 4 );
+
+    status = _settleStep( ctx );
+
+    if (newCfg)
+    {
+        ctx->settleLeft = _settleOutputs[ filterType - 1 ];
+    }
+    if (status && (ctx->settleMode == _ADC7_SETTLE_SKIP))
+    {
+        return status;
+    }
+
+    *code = _toCode( tempOut );
+
+    return status;
+}
+
+uint8_t adc7_ctxReadSample( T_adc7_ctx *ctx, T_adc7_sample *sample )
+{
+    uint8_t tempData[ 6 ];
+    uint8_t status;
+
+    _select( ctx );
+
+    if (_readBytes( 6, tempData ) == _ADC7_DATA_NOT_READY)
+    {
+        return _ADC7_DATA_NOT_READY;
+    }
+
+    status = _settleStep( ctx );
+
+    if (status && (ctx->settleMode == _ADC7_SETTLE_SKIP))
+    {
+        return status;
+    }
+    if (adc7_decodeFrame( tempData, sample ))
+    {
+        return _ADC7_WRONG_FRAME;
+    }
+
+    sample->current = ctx->cfgValid && (ctx->cfgShadow[ 0 ] == tempData[ 4 ]) && (ctx->cfgShadow[ 1 ] == tempData[ 5 ]);
+    sample->settled = ctx->settled;
+    sample->tick = ctx->drlTick;
+
+    return status;
+}
+
+uint8_t adc7_ctxCheckDataReady( T_adc7_ctx *ctx )
+{
+    _select( ctx );
+
+    return _checkDataReady();
+}
+
+uint8_t adc7_ctxCheckBusy( T_adc7_ctx *ctx )
+{
+    _select( ctx );
+
+    return _checkBusy();
+}
+
+void adc7_ctxSetClock( T_adc7_ctx *ctx, uint8_t state )
+{
+    _select( ctx );
+    _setClock( state );
+}
+
+void adc7_ctxPresetMode( T_adc7_ctx *ctx, uint8_t state )
+{
+    _select( ctx );
+    ctx->cfgValid = 0;
+    ctx->settleLeft = 0;
+
+    if (state)
+    {
+        hal_gpio_rstSet( 1 );
+    }
+    else
+    {
+        hal_gpio_rstSet( 0 );
+    }
+}
+
+uint8_t adc7_ctxReadBytes( T_adc7_ctx *ctx, uint8_t nBytes, uint8_t *dataOut )
+{
+    _select( ctx );
+
+    if (ctx->settleLeft && (ctx->settleMode == _ADC7_SETTLE_SKIP))
+    {
+        dataOut = 0;
+    }
+
+    if (_readBytes( nBytes, dataOut ))
+    {
+        return _ADC7_DATA_NOT_READY;
+    }
+
+    return _settleStep( ctx );
+}
+
+uint8_t adc7_ctxStartConvCycle( T_adc7_ctx *ctx )
+{
+    _select( ctx );
+
+    return _convCycle( ctx );
+}
+
+uint8_t adc7_ctxReadCodesBatch( T_adc7_ctx *ctx, int32_t *codes, uint16_t nSamples )
+{
+    return adc7_ctxReadCodesBatchTs( ctx, codes, 0, nSamples );
+}
+
+uint8_t adc7_ctxReadCodesBatchTs( T_adc7_ctx *ctx, int32_t *codes, uint32_t *ticks, uint16_t nSamples )
+{
+    int32_t code;
+
+    _select( ctx );
+
+    while (nSamples--)
+    {
+        do
+        {
+            if (_convCycle( ctx ) || _readCode( ctx, &code ))
+            {
+                return _ADC7_TIMEOUT;
+            }
+        }
+        while (_settleStep( ctx ) && (ctx->settleMode == _ADC7_SETTLE_SKIP));
+
+        *( codes++ ) = code;
+
+        if (ticks)
+        {
+            *( ticks++ ) = ctx->drlTick;
+        }
+    }
+
+    return _ADC7_DATA_IS_READY;
+}
+
+uint8_t adc7_ctxReadResultsBatch( T_adc7_ctx *ctx, int32_t *microVolts, uint16_t nSamples )
+{
+    int32_t code;
+
+    _select( ctx );
+
+    while (nSamples--)
+    {
+        do
+        {
+            if (_convCycle( ctx ) || _readCode( ctx, &code ))
+            {
+                return _ADC7_TIMEOUT;
+            }
+        }
+        while (_settleStep( ctx ) && (ctx->settleMode == _ADC7_SETTLE_SKIP));
+
+        *( microVolts++ ) = _toMicroVolts( ctx, code );
+    }
+
+    return _ADC7_DATA_IS_READY;
+}
+
+uint8_t adc7_ctxWaitDataReady( T_adc7_ctx *ctx )
+{
+    _select( ctx );
+
+    return _waitDrl( ctx );
+}
+
+void adc7_ctxSetTimeout( T_adc7_ctx *ctx, uint32_t polls, uint8_t recover )
+{
+    ctx->timeout = polls;
+    ctx->recover = recover;
+}
+
+uint8_t adc7_ctxReadResults( T_adc7_ctx *ctx, int16_t *voltage )
+{
+    int32_t voltData;
+    double temp;
+    uint8_t buffData[ 4 ];
+    uint8_t checkReady;
+    
+    _select( ctx );
+
+    checkReady = _readBytes( 4, buffData );
+    
+    if (checkReady)
+    {
+        return checkReady;
+    }
+
+    checkReady = _settleStep( ctx );
+
+    if (checkReady && (ctx->settleMode == _ADC7_SETTLE_SKIP))
+    {
+        return checkReady;
+    }
+    
+    voltData = _toCode( buffData );
+    
+    temp = (double)voltData / ctx->valueLSB;
+    temp *= ctx->voltRef;
+    *voltage = (int16_t)temp;
+    
+    return checkReady;
+}
+
+uint8_t adc7_ctxReadResultsUv( T_adc7_ctx *ctx, int32_t *microVolts )
+{
+    uint8_t buffData[ 4 ];
+    uint8_t checkReady;
+
+    _select( ctx );
+
+    checkReady = _readBytes( 4, buffData );
+
+    if (checkReady)
+    {
+        return checkReady;
+    }
+
+    checkReady = _settleStep( ctx );
+
+    if (checkReady && (ctx->settleMode == _ADC7_SETTLE_SKIP))
+    {
+        return checkReady;
+    }
+
+    *microVolts = _toMicroVolts( ctx, _toCode( buffData ) );
+
+    return checkReady;
+}
+
+uint8_t adc7_ctxReadResultsNv( T_adc7_ctx *ctx, int64_t *nanoVolts )
+{
+    uint8_t buffData[ 4 ];
+    uint8_t checkReady;
+
+    _select( ctx );
+
+    checkReady = _readBytes( 4, buffData );
+
+    if (checkReady)
+    {
+        return checkReady;
+    }
+
+    checkReady = _settleStep( ctx );
+
+    if (checkReady && (ctx->settleMode == _ADC7_SETTLE_SKIP))
+    {
+        return checkReady;
+    }
+
+    *nanoVolts = _toNanoVolts( ctx, _toCode( buffData ) );
+
+    return checkReady;
+}
+
+int32_t adc7_ctxCodeToMicroVolts( T_adc7_ctx *ctx, int32_t code )
+{
+    return _toMicroVolts( ctx, code );
+}
+
+int64_t adc7_ctxCodeToNanoVolts( T_adc7_ctx *ctx, int32_t code )
+{
+    return _toNanoVolts( ctx, code );
+}
+
+void adc7_ctxSetPulseTrain( T_adc7_ctx *ctx, T_adc7_pulseTrainFp pulseTrain, uint32_t rate )
+{
+    if (!rate || (rate > _ADC7_MCK_RATE_MAX))
+    {
+        rate = _ADC7_MCK_RATE_MAX;
+    }
+
+    ctx->pulseTrain = pulseTrain;
+    ctx->mckRate = rate;
+}
+
+void adc7_ctxSetResultCallback( T_adc7_ctx *ctx, T_adc7_resultFp resultCb )
+{
+    ctx->resultCb = resultCb;
+}
+
+uint8_t adc7_ctxStartConvIrq( T_adc7_ctx *ctx )
+{
+    if (ctx->irqActive || (ctx->acqState != ACQ_IDLE))
+    {
+        STATS_ADD( ctx, busyRejects, 1 );
+
+        return _ADC7_DEVICE_IS_BUSY;
+    }
+
+    _select( ctx );
+
+    ctx->irqActive = 1;
+    ctx->nyqCount = 0;
+
+    if (ctx->pulseTrain)
+    {
+        ctx->irqPulses = 0;
+        ctx->pulseTrain( ctx->numSampl, ctx->mckRate );
+        STATS_ADD( ctx, mckPulses, ctx->numSampl );
+
+        return _ADC7_DEVICE_NOT_BUSY;
+    }
+
+    ctx->irqPulses = ctx->numSampl - 1;
+
+    _setClock( 1 );
+    _setClock( 0 );
+
+    return _ADC7_DEVICE_NOT_BUSY;
+}
+
+/*
+ * ISR entry points may interrupt a call on another instance, so the HAL mapping
+ * of the interrupted instance is restored on exit.
+ * MCK high time in interrupt mode is the GPIO access time, which exceeds t_MCKH (20 ns).
+ */
+void adc7_ctxBusyIsr( T_adc7_ctx *ctx )
+{
+    T_adc7_ctx *prevCtx = _activeCtx;
+
+    if (!ctx->irqActive || (!ctx->irqPulses && !ctx->nyqRead))
+    {
+        return;
+    }
+
+    _isrSelect( ctx );
+
+    if (ctx->nyqRead)
+    {
+        _nyqCapture( ctx );
+    }
+    if (ctx->irqPulses)
+    {
+        ctx->irqPulses--;
+        _setClock( 1 );
+        _setClock( 0 );
+    }
+
+    if (prevCtx)
+    {
+        _isrSelect( prevCtx );
+    }
+}
+
+void adc7_ctxDrlIsr( T_adc7_ctx *ctx )
+{
+    T_adc7_ctx *prevCtx = _activeCtx;
+    uint8_t buffData[ 4 ];
+
+    if (!ctx->irqActive)
+    {
+        return;
+    }
+
+    _isrSelect( ctx );
+
+    // DRL is not read back on the DMA path, the interrupt edge is the data ready time
+    if (ctx->dmaCycle)
+    {
+        _stamp( ctx );
+
+        // unsettled result is clocked out and discarded in skip mode, it never reaches the buffer
+        if (_settleStep( ctx ) && (ctx->settleMode == _ADC7_SETTLE_SKIP))
+        {
+            hal_gpio_csSet( 0 );
+            hal_spiRead( buffData, 4 );
+            hal_gpio_csSet( 1 );
+            STATS_ADD( ctx, spiBytes, 4 );
+
+            ctx->irqActive = 0;
+
+            // no transfer follows, the capture ends here after adc7_ctxDmaStop
+            if (!ctx->dmaRun)
+            {
+                ctx->dmaCycle = 0;
+            }
+        }
+        else
+        {
+            if (ctx->dmaTicks[ ctx->dmaFill ])
+            {
+                ctx->dmaTicks[ ctx->dmaFill ][ ctx->dmaCount ] = ctx->drlTick;
+            }
+            if (ctx->dmaSettled[ ctx->dmaFill ])
+            {
+                ctx->dmaSettled[ ctx->dmaFill ][ ctx->dmaCount ] = ctx->settled;
+            }
+
+            hal_gpio_csSet( 0 );
+            ctx->dmaRead( ctx->dmaBuf[ ctx->dmaFill ] + ctx->dmaCount * ctx->dmaFrameLen, ctx->dmaFrameLen );
+            STATS_ADD( ctx, spiBytes, ctx->dmaFrameLen );
+
+            ctx->irqActive = 0;
+        }
+
+        // the last cycle after adc7_ctxDmaStop still goes to the DMA buffer, adc7_ctxDmaIsr ends the capture
+        if (ctx->dmaRun)
+        {
+            adc7_ctxStartConvIrq( ctx );
+        }
+    }
+    else if (_readBytes( 4, buffData ) == _ADC7_DATA_IS_READY)
+    {
+        ctx->irqActive = 0;
+
+        if (_settleStep( ctx ) && (ctx->settleMode == _ADC7_SETTLE_SKIP))
+        {
+            adc7_ctxStartConvIrq( ctx );
+        }
+        else
+        {
+            if (ctx->ring)
+            {
+                adc7_ringPushTs( ctx->ring, _toCode( buffData ), ctx->drlTick );
+            }
+            if (ctx->resultCb)
+            {
+                ctx->resultCb( ctx, _toCode( buffData ) );
+            }
+        }
+    }
+
+    if (prevCtx)
+    {
+        _isrSelect( prevCtx );
+    }
+}
+
+void adc7_ctxAttachRing( T_adc7_ctx *ctx, T_adc7_ring *ring )
+{
+    ctx->ring = ring;
+}
+
+void adc7_ctxDmaInit( T_adc7_ctx *ctx, T_adc7_dmaReadFp dmaRead, uint8_t *buf0, uint8_t *buf1, uint16_t nFrames, uint8_t frameLen )
+{
+    ctx->dmaRead = dmaRead;
+    ctx->dmaBuf[ 0 ] = buf0;
+    ctx->dmaBuf[ 1 ] = buf1;
+    ctx->dmaFrames = nFrames;
+    ctx->dmaFrameLen = frameLen;
+    ctx->dmaTicks[ 0 ] = 0;
+    ctx->dmaTicks[ 1 ] = 0;
+    ctx->dmaSettled[ 0 ] = 0;
+    ctx->dmaSettled[ 1 ] = 0;
+    ctx->dmaRun = 0;
+    ctx->dmaCycle = 0;
+}
+
+void adc7_ctxDmaSetTicks( T_adc7_ctx *ctx, uint32_t *ticks0, uint32_t *ticks1 )
+{
+    ctx->dmaTicks[ 0 ] = ticks0;
+    ctx->dmaTicks[ 1 ] = ticks1;
+}
+
+void adc7_ctxDmaSetSettleFlags( T_adc7_ctx *ctx, uint8_t *flags0, uint8_t *flags1 )
+{
+    ctx->dmaSettled[ 0 ] = flags0;
+    ctx->dmaSettled[ 1 ] = flags1;
+}
+
+uint8_t adc7_ctxDmaStart( T_adc7_ctx *ctx )
+{
+    if (ctx->irqActive || ctx->dmaCycle || (ctx->acqState != ACQ_IDLE))
+    {
+        return _ADC7_DEVICE_IS_BUSY;
+    }
+
+    ctx->dmaFill = 0;
+    ctx->dmaCount = 0;
+    ctx->dmaReady = 0;
+    ctx->dmaOverruns = 0;
+    ctx->dmaRun = 1;
+    ctx->dmaCycle = 1;
+
+    return adc7_ctxStartConvIrq( ctx );
+}
+
+void adc7_ctxDmaStop( T_adc7_ctx *ctx )
+{
+    ctx->dmaRun = 0;
+}
+
+/*
+ * When the application still holds the previous buffer, the buffer being filled is
+ * overwritten from the start and the overrun is counted.
+ */
+void adc7_ctxDmaIsr( T_adc7_ctx *ctx )
+{
+    T_adc7_ctx *prevCtx = _activeCtx;
+
+    _isrSelect( ctx );
+
+    hal_gpio_csSet( 1 );
+
+    if (++ctx->dmaCount >= ctx->dmaFrames)
+    {
+        ctx->dmaCount = 0;
+
+        if (ctx->dmaReady)
+        {
+            ctx->dmaOverruns++;
+        }
+        else
+        {
+            ctx->dmaReady = 1;
+            ctx->dmaFill ^= 1;
+        }
+    }
+
+    if (!ctx->dmaRun && !ctx->irqActive)
+    {
+        ctx->dmaCycle = 0;
+    }
+
+    if (prevCtx)
+    {
+        _isrSelect( prevCtx );
+    }
+}
+
+uint8_t* adc7_ctxDmaGetBuffer( T_adc7_ctx *ctx )
+{
+    if (!ctx->dmaReady)
+    {
+        return 0;
+    }
+
+    return ctx->dmaBuf[ ctx->dmaFill ^ 1 ];
+}
+
+uint32_t* adc7_ctxDmaGetTicks( T_adc7_ctx *ctx )
+{
+    if (!ctx->dmaReady)
+    {
+        return 0;
+    }
+
+    return ctx->dmaTicks[ ctx->dmaFill ^ 1 ];
+}
+
+uint8_t* adc7_ctxDmaGetSettleFlags( T_adc7_ctx *ctx )
+{
+    if (!ctx->dmaReady)
+    {
+        return 0;
+    }
+
+    return ctx->dmaSettled[ ctx->dmaFill ^ 1 ];
+}
+
+void adc7_ctxDmaReleaseBuffer( T_adc7_ctx *ctx )
+{
+    ctx->dmaReady = 0;
+}
+
+void adc7_ctxSetNyquist( T_adc7_ctx *ctx, T_adc7_nyqReadFp nyqRead, int32_t *buf, uint16_t size )
+{
+    ctx->nyqRead = 0;
+    ctx->nyqBuf = buf;
+    ctx->nyqSize = size;
+    ctx->nyqCount = 0;
+    ctx->nyqRead = nyqRead;
+}
+
+uint16_t adc7_ctxGetNyquistCount( T_adc7_ctx *ctx )
+{
+    return ctx->nyqCount;
+}
+
+void adc7_ctxSetSettleMode( T_adc7_ctx *ctx, uint8_t mode )
+{
+    ctx->settleMode = mode;
+}
+
+uint8_t adc7_ctxGetSettleCount( T_adc7_ctx *ctx )
+{
+    return ctx->settleLeft;
+}
+
+uint8_t adc7_ctxIsSettled( T_adc7_ctx *ctx )
+{
+    return ctx->settled;
+}
+
+void adc7_ctxSetTickSource( T_adc7_ctx *ctx, T_adc7_tickFp tick )
+{
+    ctx->tick = tick;
+    ctx->drlTick = 0;
+}
+
+uint32_t adc7_ctxGetTimestamp( T_adc7_ctx *ctx )
+{
+    return ctx->drlTick;
+}
+
+uint8_t adc7_ctxStartAcquisition( T_adc7_ctx *ctx )
+{
+    if (ctx->irqActive || (ctx->acqState != ACQ_IDLE))
+    {
+        STATS_ADD( ctx, busyRejects, 1 );
+
+        return _ADC7_DEVICE_IS_BUSY;
+    }
+
+    ctx->nyqCount = 0;
+    ctx->acqPolls = 0;
+
+    if (ctx->pulseTrain)
+    {
+        _select( ctx );
+
+        ctx->pulseTrain( ctx->numSampl, ctx->mckRate );
+        STATS_ADD( ctx, mckPulses, ctx->numSampl );
+        ctx->acqState = ACQ_DRL;
+    }
+    else
+    {
+        ctx->acqPulses = ctx->numSampl;
+        ctx->acqState = ACQ_PULSE;
+    }
+
+    return _ADC7_DEVICE_NOT_BUSY;
+}
+
+uint8_t adc7_ctxPoll( T_adc7_ctx *ctx, int32_t *code )
+{
+    uint8_t buffData[ 4 ];
+    uint8_t status;
+
+    if (ctx->acqState == ACQ_IDLE)
+    {
+        return _ADC7_ACQ_IDLE;
+    }
+
+    _select( ctx );
+
+    switch (ctx->acqState)
+    {
+        case ACQ_BUSY :
+        {
+            if (_checkBusy() == _ADC7_DEVICE_IS_BUSY)
+            {
+                if (ctx->timeout && (++ctx->acqPolls >= ctx->timeout))
+                {
+                    ctx->acqState = ACQ_IDLE;
+
+                    return _timeout( ctx );
+                }
+
+                return _ADC7_DATA_NOT_READY;
+            }
+            if (ctx->nyqRead)
+            {
+                _nyqCapture( ctx );
+            }
+            ctx->acqPolls = 0;
+
+            if (--ctx->acqPulses == 0)
+            {
+                ctx->acqState = ACQ_DRL;
+
+                return _ADC7_DATA_NOT_READY;
+            }
+        }
+        /* fall through - conversion finished, next pulse is issued in the same call */
+        case ACQ_PULSE :
+        {
+            _setClock( 1 );
+            _setClock( 0 );
+            ctx->acqState = ACQ_BUSY;
+
+            return _ADC7_DATA_NOT_READY;
+        }
+        default :
+        {
+        break;
+        }
+    }
+
+    if (_checkDataReady() == _ADC7_DATA_NOT_READY)
+    {
+        if (ctx->timeout && (++ctx->acqPolls >= ctx->timeout))
+        {
+            ctx->acqState = ACQ_IDLE;
+
+            return _timeout( ctx );
+        }
+
+        return _ADC7_DATA_NOT_READY;
+    }
+
+    hal_gpio_csSet( 0 );
+    hal_spiRead( buffData, 4 );
+    hal_gpio_csSet( 1 );
+    STATS_ADD( ctx, spiBytes, 4 );
+
+    ctx->acqState = ACQ_IDLE;
+    status = _settleStep( ctx );
+
+    if (status && (ctx->settleMode == _ADC7_SETTLE_SKIP))
+    {
+        adc7_ctxStartAcquisition( ctx );
+
+        return _ADC7_DATA_NOT_READY;
+    }
+
+    *code = _toCode( buffData );
+
+    return status;
+}
+
+uint16_t adc7_ctxTlmFrame( T_adc7_ctx *ctx, int32_t *codes, uint32_t *ticks, uint8_t nCodes, uint8_t *frame )
+{
+    T_tlmEnc enc;
+    uint16_t crc;
+    uint8_t count;
+
+    if ((nCodes == 0) || (nCodes > _ADC7_TLM_CODES_MAX))
+    {
+        return 0;
+    }
+
+    enc.out = frame;
+    enc.len = 1;
+    enc.codeIdx = 0;
+    enc.crc = 0xFFFF;
+
+    _tlmPut( &enc, _ADC7_TLM_VERSION, 1 );
+    _tlmPut( &enc, ctx->tlmSeq++, 2 );
+    _tlmPut( &enc, ctx->cfgValid ? ctx->cfgShadow[ 0 ] : 0, 1 );
+    _tlmPut( &enc, ctx->cfgValid ? ctx->cfgShadow[ 1 ] : 0, 1 );
+    _tlmPut( &enc, ticks ? ticks[ 0 ] : 0, 4 );
+    _tlmPut( &enc, ticks ? ticks[ nCodes - 1 ] : 0, 4 );
+    _tlmPut( &enc, nCodes, 1 );
+
+    for (count = 0; count < nCodes; count++)
+    {
+        _tlmPut( &enc, (uint32_t)codes[ count ], 4 );
+    }
+
+    crc = enc.crc;
+    _tlmPut( &enc, crc, 2 );
+
+    frame[ enc.codeIdx ] = enc.len - enc.codeIdx;
+    frame[ enc.len++ ] = 0x00;
+
+    return enc.len;
+}
+
+#ifdef __ADC7_STATS__
+void adc7_ctxGetStats( T_adc7_ctx *ctx, T_adc7_stats *stats )
+{
+    *stats = ctx->stats;
+}
+
+void adc7_ctxResetStats( T_adc7_ctx *ctx )
+{
+    ctx->stats.mckPulses = 0;
+    ctx->stats.busyPolls = 0;
+    ctx->stats.drlPolls = 0;
+    ctx->stats.spiBytes = 0;
+    ctx->stats.cfgWrites = 0;
+    ctx->stats.notReady = 0;
+    ctx->stats.busyRejects = 0;
+    ctx->stats.timeouts = 0;
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+/*
+  __adc7_driver.c
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+3. All advertising materials mentioning features or use of this software
+   must display the following acknowledgement:
+   This product includes software developed by the MikroElektonika.
+
+4. Neither the name of the MikroElektonika nor the
+   names of its contributors may be used to endorse or promote products
+   derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY MIKROELEKTRONIKA ''AS IS'' AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL MIKROELEKTRONIKA BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------------- */
@@ -50,6 +50,7 @@
    #define   __ADC7_DRV_SPI__                            /**<     @macro __ADC7_DRV_SPI__  @brief SPI driver selector */
 //  #define   __ADC7_DRV_I2C__                            /**<     @macro __ADC7_DRV_I2C__  @brief I2C driver selector */                                          
 // #define   __ADC7_DRV_UART__                           /**<     @macro __ADC7_DRV_UART__ @brief UART driver selector */ 
+// #define   __ADC7_STATS__                              /**<     @macro __ADC7_STATS__    @brief Instrumentation counters */
 
                                                                        /** @} */
 /** @defgroup ADC7_VAR Variables */                           /** @{ */
@@ -91,14 +92,201 @@ extern const uint8_t _ADC7_DEVICE_NOT_BUSY       ;
 extern const uint8_t _ADC7_WRONG_GAIN_CONFIG     ;
 extern const uint8_t _ADC7_WRONG_DOWNSAMPL_FACT  ;
 extern const uint8_t _ADC7_WRONG_FILT_TYPE       ;
+extern const uint8_t _ADC7_WRONG_FRAME           ;
+extern const uint8_t _ADC7_DATA_NOT_SETTLED      ;
+extern const uint8_t _ADC7_ACQ_IDLE              ;
+extern const uint8_t _ADC7_TIMEOUT               ;
+
+/** Settling Mode */
+extern const uint8_t _ADC7_SETTLE_OFF            ;
+extern const uint8_t _ADC7_SETTLE_SKIP           ;
+extern const uint8_t _ADC7_SETTLE_FLAG           ;
 
 extern const uint8_t _ADC7_HIGH_STATE            ;
 extern const uint8_t _ADC7_LOW_STATE             ;
 
+/** MCK Rate */
+extern const uint32_t _ADC7_MCK_RATE_MAX         ;
+
+/** Telemetry Frame */
+#define _ADC7_TLM_VERSION               0x01
+#define _ADC7_TLM_CODES_MAX             64
+#define _ADC7_TLM_HEADER_LEN            14
+#define _ADC7_TLM_FRAME_MAX(n)          (_ADC7_TLM_HEADER_LEN + 4 * (n) + 2 + (_ADC7_TLM_HEADER_LEN + 4 * (n) + 2) / 254 + 2)
+
                                                                        /** @} */
 /** @defgroup ADC7_TYPES Types */                             /** @{ */
 
+/**
+ * @brief Ring Index Type
+ *
+ * Indices are read and written atomically on 8-bit targets, which limits the ring to 128 entries there.
+ */
+#if defined( __MIKROC_PRO_FOR_PIC__ ) || defined( __MIKROC_PRO_FOR_AVR__ )
+typedef uint8_t     T_adc7_ringIdx;
+#else
+typedef uint16_t    T_adc7_ringIdx;
+#endif
+
+/**
+ * @brief Sample Ring
+ *
+ * Single-producer/single-consumer lock-free ring of 32-bit results. Producer is the acquisition
+ * interrupt, consumer is the main loop.
+ */
+typedef struct
+{
+    int32_t                     *buf;
+    uint32_t                    *ticks;      /**< Optional timestamps, same size as buf */
+    T_adc7_ringIdx              mask;
+    volatile T_adc7_ringIdx     head;        /**< Written only by producer */
+    volatile T_adc7_ringIdx     tail;        /**< Written only by consumer */
+    volatile uint32_t           overruns;    /**< Results dropped because the ring was full */
+
+}T_adc7_ring;
+
+/**
+ * @brief Tagged Sample
+ *
+ * 32-bit result with the configuration echoed by the device in the extended readout.
+ */
+typedef struct
+{
+    int32_t     code;
+    uint8_t     gainConfig;
+    uint8_t     downSampFactor;
+    uint8_t     filterType;
+    uint8_t     current;                 /**< 1 - produced under the last configuration written by the driver */
+    uint8_t     settled;                 /**< 1 - digital filter was settled */
+    uint32_t    tick;                    /**< Timestamp of data ready, 0 - no tick source */
+
+}T_adc7_sample;
 
+#ifdef __ADC7_STATS__
+/**
+ * @brief Instrumentation Counters
+ *
+ * Counted by the driver when __ADC7_STATS__ is defined, the counters wrap around.
+ */
+typedef struct
+{
+    uint32_t    mckPulses;               /**< MCK pulses issued, bit-banged or requested from the pulse train generator */
+    uint32_t    busyPolls;               /**< BUSY pin reads */
+    uint32_t    drlPolls;                /**< DRL pin reads */
+    uint32_t    spiBytes;                /**< Bytes transferred on SDOA/SDI and SDOB */
+    uint32_t    cfgWrites;               /**< Configuration words written to the device */
+    uint32_t    notReady;                /**< Reads rejected because data was not ready */
+    uint32_t    busyRejects;             /**< Requests rejected because the device or the instance was busy */
+    uint32_t    timeouts;                /**< BUSY or DRL waits which exceeded the deadline */
+
+}T_adc7_stats;
+#endif
+
+struct T_adc7_ctx_s;
+
+/**
+ * @brief Result Callback
+ *
+ * Called from adc7_drlIsr with the 32-bit filtered result of the completed conversion cycle.
+ */
+typedef void (*T_adc7_resultFp)(struct T_adc7_ctx_s *ctx, int32_t result);
+
+/**
+ * @brief MCK Pulse Train Generator
+ *
+ * Generates exactly count pulses on MCK (PWM pin) at rate Hz using a hardware timer/PWM output.
+ * The function may return before the train is finished.
+ */
+typedef void (*T_adc7_pulseTrainFp)(uint16_t count, uint32_t rate);
+
+/**
+ * @brief DMA SPI Read
+ *
+ * Starts a DMA transfer clocking nBytes from SPI (0x00 on MOSI) into pOut and returns.
+ * Transfer complete interrupt handler should call adc7_dmaIsr.
+ */
+typedef void (*T_adc7_dmaReadFp)(uint8_t *pOut, uint16_t nBytes);
+
+/**
+ * @brief Nyquist Read
+ *
+ * Reads nBytes from the second serial port (SDOB/SCKB) into pOut, RDLB is controlled by the function.
+ */
+typedef void (*T_adc7_nyqReadFp)(uint8_t *pOut, uint16_t nBytes);
+
+/**
+ * @brief Tick Source
+ *
+ * Returns a free running monotonic tick (cycle counter, timer ...). Wrap around is allowed,
+ * differences of consecutive timestamps are valid as long as they fit in 32 bits.
+ */
+typedef uint32_t (*T_adc7_tickFp)(void);
+
+/**
+ * @brief Driver Instance
+ *
+ * Holds the HAL objects and conversion state of one ADC 7 Click.
+ * Fields are managed by the driver, the application only allocates the object.
+ */
+typedef struct T_adc7_ctx_s
+{
+    T_ADC7_P    gpioObj;
+    T_ADC7_P    spiObj;
+
+    uint16_t    numSampl;
+    float       voltRef;
+    uint32_t    valueLSB;
+    uint32_t    scaleUv;
+    uint64_t    scaleNv;
+    uint8_t     cfgShadow[ 2 ];          /**< Last configuration word written to the device */
+    uint8_t     cfgValid;                /**< cfgShadow matches the device configuration */
+    uint8_t     settleMode;
+    uint8_t     settleLeft;              /**< Unsettled outputs remaining after the last filter synchronization */
+    uint8_t     settled;                 /**< Last result read was settled */
+
+    T_adc7_tickFp       tick;
+    volatile uint32_t   drlTick;         /**< Timestamp of the last data ready */
+
+#ifdef __ADC7_STATS__
+    T_adc7_stats        stats;
+#endif
+
+    uint8_t     acqState;
+    uint16_t    acqPulses;
+    uint32_t    acqPolls;
+
+    uint32_t    timeout;                 /**< BUSY/DRL wait deadline in pin polls, 0 - wait forever */
+    uint8_t     recover;
+
+    volatile uint16_t   irqPulses;
+    volatile uint8_t    irqActive;
+    T_adc7_resultFp     resultCb;
+    T_adc7_ring         *ring;
+
+    T_adc7_pulseTrainFp pulseTrain;
+    uint32_t            mckRate;
+
+    T_adc7_dmaReadFp    dmaRead;
+    uint8_t             *dmaBuf[ 2 ];
+    uint32_t            *dmaTicks[ 2 ];      /**< Per frame data ready ticks of each buffer, optional */
+    uint8_t             *dmaSettled[ 2 ];    /**< Per frame settled flags of each buffer, optional */
+    uint16_t            dmaFrames;
+    uint8_t             dmaFrameLen;
+    volatile uint8_t    dmaRun;
+    volatile uint8_t    dmaCycle;            /**< DMA capture active, cleared when the last frame after stop is transferred */
+    volatile uint8_t    dmaFill;
+    volatile uint8_t    dmaReady;
+    volatile uint16_t   dmaCount;
+    volatile uint16_t   dmaOverruns;         /**< Buffers dropped because the application did not release the previous one */
+
+    T_adc7_nyqReadFp    nyqRead;
+    int32_t             *nyqBuf;
+    uint16_t            nyqSize;
+    volatile uint16_t   nyqCount;
+
+    uint16_t            tlmSeq;              /**< Sequence number of the next telemetry frame */
+
+}T_adc7_ctx;
 
                                                                        /** @} */
 #ifdef __cplusplus
@@ -109,6 +297,20 @@ extern "C"{
 
 #ifdef   __ADC7_DRV_SPI__
 void adc7_spiDriverInit(T_ADC7_P gpioObj, T_ADC7_P spiObj);
+
+/**
+ * @brief Instance Initialization function
+ *
+ * @param[out] ctx  Driver instance
+ * @param[in] gpioObj  GPIO object of the mikroBUS slot
+ * @param[in] spiObj  SPI object of the mikroBUS slot
+ *
+ * Function initializes one ADC 7 Click instance. Each instance can be used with adc7_ctx... functions,
+ * instances can be sampled in any order.
+ * @note
+ * Functions without ctx argument operate on the instance initialized by adc7_spiDriverInit.
+ */
+void adc7_ctxSpiDriverInit(T_adc7_ctx *ctx, T_ADC7_P gpioObj, T_ADC7_P spiObj);
 #endif
 #ifdef   __ADC7_DRV_I2C__
 void adc7_i2cDriverInit(T_ADC7_P gpioObj, T_ADC7_P i2cObj, uint8_t slave);
@@ -134,6 +336,8 @@ void adc7_uartDriverInit(T_ADC7_P gpioObj, T_ADC7_P uartObj);
  * Configuration should be performed only if device is not busy.
  * If you want to continue the conversions with the same configuration, you should write 0x00 when you read data.
  * It's not necessary to repeat configuration set function.
+ * The last written configuration is cached, writing the same configuration again is skipped
+ * (no SPI transfer, the digital filter is not restarted) and returns 0 - not busy.
  */
 uint8_t adc7_setConfig( uint8_t gainConfig, uint8_t downSampFactor, uint8_t filterType );
 
@@ -173,6 +377,8 @@ void adc7_setClock( uint8_t state );
  * @param[in] state  0 - Normal Mode, 1 - Preset Mode
  *
  * Function puts the device to Preset or to Normal Mode.
+ * @note
+ * Preset Mode restores the default configuration, so the next adc7_setConfig call is always written.
  */
 void adc7_presetMode( uint8_t state );
 
@@ -182,9 +388,10 @@ void adc7_presetMode( uint8_t state );
  * @param[in] nBytes  Number of bytes to be read
  * @param[out] dataOut  Memory where data bytes be stored
  *
- * @returns Is data ready or not
+ * @returns Is data ready or not, _ADC7_DATA_NOT_SETTLED - result is not settled (see adc7_setSettleMode)
  *
  * Function reads the desired number of data bytes (32-bit converted data from ADC + configuration byte/bytes).
+ * In settling skip mode an unsettled result is clocked out and discarded, dataOut is left unchanged.
  */
 uint8_t adc7_readBytes( uint8_t nBytes, uint8_t *dataOut );
 
@@ -193,10 +400,15 @@ uint8_t adc7_readBytes( uint8_t nBytes, uint8_t *dataOut );
  *
  * Function generates clock signal on MCK pin and on that way starts and performs the desired number of conversion cycles,
  * determined by Down Sampling Factor number.
+ * @returns 0 - Conversion cycle done, _ADC7_TIMEOUT - BUSY or DRL did not change before the deadline
+ *
  * @note
  * When all conversion cycles be done, then data should be read.
+ * If pulse train generator is set, function returns when DRL indicates that data is ready.
+ * An open MCK line is not detected: BUSY never rises, so the function returns 0 and the fault
+ * shows up as _ADC7_TIMEOUT from adc7_waitDataReady.
  */
-void adc7_startConvCycle( void );
+uint8_t adc7_startConvCycle( void );
 
 /**
  * @brief Results Read function
@@ -211,6 +423,610 @@ void adc7_startConvCycle( void );
  */
 uint8_t adc7_readResults( int16_t *voltage );
 
+/**
+ * @brief Results Read function (uV)
+ *
+ * @param[out] microVolts  Memory where converted voltage value be stored
+ *
+ * @returns Is data ready or not
+ *
+ * Function reads 32bit converted voltage value from AD converter and calculates this value to uV
+ * using integer arithmetic only.
+ */
+uint8_t adc7_readResultsUv( int32_t *microVolts );
+
+/**
+ * @brief Results Read function (nV)
+ *
+ * @param[out] nanoVolts  Memory where converted voltage value be stored
+ *
+ * @returns Is data ready or not
+ *
+ * Function reads 32bit converted voltage value from AD converter and calculates this value to nV
+ * using integer arithmetic only.
+ */
+uint8_t adc7_readResultsNv( int64_t *nanoVolts );
+
+/**
+ * @brief Code to uV function
+ *
+ * @param[in] code  32-bit result
+ *
+ * @returns Voltage in uV for the active gain configuration
+ */
+int32_t adc7_codeToMicroVolts( int32_t code );
+
+/**
+ * @brief Code to nV function
+ *
+ * @param[in] code  32-bit result
+ *
+ * @returns Voltage in nV for the active gain configuration
+ */
+int64_t adc7_codeToNanoVolts( int32_t code );
+
+/**
+ * @brief Batch Codes Read function
+ *
+ * @param[out] codes  Memory where nSamples 32-bit results be stored
+ * @param[in] nSamples  Number of conversion cycles
+ *
+ * @returns 0 - All results stored, _ADC7_TIMEOUT - batch stopped, results before the timeout are stored
+ *
+ * Function performs nSamples conversion cycles back-to-back, each followed by waiting for
+ * data ready and reading the 32-bit result.
+ */
+uint8_t adc7_readCodesBatch( int32_t *codes, uint16_t nSamples );
+
+/**
+ * @brief Batch Results Read function
+ *
+ * @param[out] microVolts  Memory where nSamples converted voltage values be stored
+ * @param[in] nSamples  Number of conversion cycles
+ *
+ * Same as adc7_readCodesBatch, results are converted to uV.
+ */
+uint8_t adc7_readResultsBatch( int32_t *microVolts, uint16_t nSamples );
+
+/**
+ * @brief Timestamped Batch Codes Read function
+ *
+ * @param[out] codes  Memory where nSamples 32-bit results be stored
+ * @param[out] ticks  Memory where nSamples data ready timestamps be stored
+ * @param[in] nSamples  Number of conversion cycles
+ *
+ * Same as adc7_readCodesBatch, each result is stored with the tick captured when DRL was observed low.
+ */
+uint8_t adc7_readCodesBatchTs( int32_t *codes, uint32_t *ticks, uint16_t nSamples );
+
+/**
+ * @brief Data Ready Wait function
+ *
+ * @returns 0 - Data is ready, _ADC7_TIMEOUT - DRL did not fall before the deadline
+ *
+ * Bounded replacement for polling adc7_checkDataReady in a loop.
+ */
+uint8_t adc7_waitDataReady( void );
+
+/**
+ * @brief Timeout Set function
+ *
+ * @param[in] polls  Deadline of every BUSY and DRL wait in pin polls, 0 - wait forever (default)
+ * @param[in] recover  1 - run the recovery sequence on timeout
+ *
+ * Waits which exceed the deadline return _ADC7_TIMEOUT, so a stuck or disconnected device cannot hang
+ * the application. Recovery drives MCK low and CS high, pulses PRE to reset the device and writes the last
+ * configuration again. The result of the failed cycle is lost, the next cycle can be started right away.
+ * @note
+ * A poll is one GPIO read, the deadline should exceed Down Sampling Factor conversion periods
+ * for DRL waits in pulse train mode.
+ */
+void adc7_setTimeout( uint32_t polls, uint8_t recover );
+
+/**
+ * @brief Tick Source Set function
+ *
+ * @param[in] tick  Monotonic tick source, 0 - timestamps disabled
+ *
+ * Timestamp is captured each time the driver observes DRL low (adc7_checkDataReady, result reads,
+ * batch and non-blocking acquisition, adc7_drlIsr), a result gets the tick of the last observation
+ * before it was read. DMA frames get the tick of the adc7_drlIsr entry, see adc7_dmaSetTicks.
+ */
+void adc7_setTickSource( T_adc7_tickFp tick );
+
+/**
+ * @brief Timestamp Get function
+ *
+ * @returns Tick captured at the last data ready, 0 if no tick source is set
+ */
+uint32_t adc7_getTimestamp( void );
+
+/**
+ * @brief Read And Configure function
+ *
+ * @param[in] gainConfig  Gain configuration for the next conversion cycle (0-3)
+ * @param[in] downSampFactor  Down Sampling Factor for the next conversion cycle (2-14)
+ * @param[in] filterType  Filter Type for the next conversion cycle (1-7)
+ * @param[out] code  Memory where 32-bit result of the finished conversion cycle be stored
+ *
+ * @returns Is data ready or not, or wrong configuration parameter
+ *
+ * Function reads the 32-bit result and sends the configuration word in the same SPI frame,
+ * so a scanning application pays one SPI transaction per sample.
+ * @note
+ * The result is produced by the previous configuration, while adc7_codeToMicroVolts and
+ * adc7_startConvCycle use the new one after this call.
+ * If the configuration is the same as the cached one, 0x00 is sent and the filter is not restarted.
+ */
+uint8_t adc7_readAndConfig( uint8_t gainConfig, uint8_t downSampFactor, uint8_t filterType, int32_t *code );
+
+/**
+ * @brief Tagged Sample Read function
+ *
+ * @param[out] sample  Memory where result and echoed configuration be stored
+ *
+ * @returns Is data ready or not, or _ADC7_WRONG_FRAME if the configuration trailer is not valid
+ *
+ * Function reads the extended 6-byte frame (32-bit result + 2 configuration bytes) and tags the
+ * result with the gain, down sampling factor and filter type it was produced under.
+ */
+uint8_t adc7_readSample( T_adc7_sample *sample );
+
+/**
+ * @brief Extended Frame Decode function
+ *
+ * @param[in] frame  6-byte extended frame, read by adc7_readBytes or DMA
+ * @param[out] sample  Memory where result and echoed configuration be stored
+ *
+ * @returns 0 - Frame is valid, _ADC7_WRONG_FRAME - configuration trailer is not valid
+ *
+ * sample->current is not set by this function, it needs the driver state.
+ */
+uint8_t adc7_decodeFrame( uint8_t *frame, T_adc7_sample *sample );
+
+/**
+ * @brief Pulse Train Set function
+ *
+ * @param[in] pulseTrain  MCK pulse train generator, 0 - MCK is bit-banged by the driver
+ * @param[in] rate  MCK rate in Hz, limited to _ADC7_MCK_RATE_MAX
+ *
+ * When pulse train generator is set, adc7_startConvCycle and adc7_startConvIrq hand the whole
+ * pulse train to it and the driver only waits for DRL.
+ */
+void adc7_setPulseTrain( T_adc7_pulseTrainFp pulseTrain, uint32_t rate );
+
+                                                                       /** @} */
+/** @defgroup ADC7_POLL Non-blocking Acquisition */           /** @{ */
+
+/**
+ * @brief Acquisition Start function
+ *
+ * @returns 0 - Acquisition armed, 1 - Acquisition or interrupt driven cycle already in progress
+ *
+ * Function arms one conversion cycle and returns immediately, the cycle is advanced by adc7_poll.
+ * With a pulse train generator, the whole train is started here.
+ */
+uint8_t adc7_startAcquisition( void );
+
+/**
+ * @brief Acquisition Poll function
+ *
+ * @param[out] code  Memory where 32-bit result be stored when the cycle is finished
+ *
+ * @returns _ADC7_DATA_IS_READY - result stored, _ADC7_DATA_NOT_READY - cycle in progress,
+ * _ADC7_DATA_NOT_SETTLED - unsettled result (see adc7_setSettleMode), _ADC7_ACQ_IDLE - nothing armed,
+ * _ADC7_TIMEOUT - BUSY or DRL did not change within the deadline polls (see adc7_setTimeout), cycle is aborted
+ *
+ * Function never waits. Each call reads BUSY or DRL once and performs the step it unblocks:
+ * the next MCK pulse, or the result readout. It should be called periodically from the main loop;
+ * the cycle takes at least Down Sampling Factor calls.
+ * In skip settling mode, an unsettled result is dropped and the next cycle is armed automatically.
+ */
+uint8_t adc7_poll( int32_t *code );
+
+                                                                       /** @} */
+/** @defgroup ADC7_IRQ Interrupt Driven Conversion */         /** @{ */
+
+/**
+ * @brief Result Callback Set function
+ *
+ * @param[in] resultCb  Function called when filtered result of interrupt driven cycle is read
+ */
+void adc7_setResultCallback( T_adc7_resultFp resultCb );
+
+/**
+ * @brief Interrupt Driven Conversion Start function
+ *
+ * @returns 0 - Cycle started, 1 - Previous cycle still in progress
+ *
+ * Function generates the first MCK pulse and returns. Remaining pulses are generated from adc7_busyIsr,
+ * the result is read from adc7_drlIsr and passed to the result callback.
+ * @note
+ * BUSY (INT pin) and DRL (AN pin) falling edge interrupts should be enabled and their handlers
+ * should call adc7_busyIsr and adc7_drlIsr.
+ */
+uint8_t adc7_startConvIrq( void );
+
+/**
+ * @brief BUSY Falling Edge Handler
+ *
+ * Function generates the next MCK pulse until the number of conversions determined by
+ * Down Sampling Factor is reached.
+ */
+void adc7_busyIsr( void );
+
+/**
+ * @brief DRL Falling Edge Handler
+ *
+ * Function reads the 32-bit filtered result and passes it to the result callback.
+ */
+void adc7_drlIsr( void );
+
+/**
+ * @brief Ring Attach function
+ *
+ * @param[in] ring  Ring which receives results of interrupt driven cycles, 0 - detach
+ *
+ * Function connects the ring to adc7_drlIsr. Each result is pushed to the ring before the result callback is called.
+ * If the ring has timestamp storage, the data ready tick is pushed with the result.
+ */
+void adc7_attachRing( T_adc7_ring *ring );
+
+                                                                       /** @} */
+/** @defgroup ADC7_RING Sample Ring */                        /** @{ */
+
+/**
+ * @brief Ring Initialization function
+ *
+ * @param[out] ring  Ring object
+ * @param[in] buf  Storage for size results
+ * @param[in] size  Number of entries, power of 2 (max 128 on 8-bit targets, 32768 otherwise)
+ */
+void adc7_ringInit( T_adc7_ring *ring, int32_t *buf, T_adc7_ringIdx size );
+
+/**
+ * @brief Ring Timestamp Storage Set function
+ *
+ * @param[in] ring  Ring object
+ * @param[in] ticks  Storage for size timestamps, 0 - results only
+ *
+ * @note
+ * Should be called after adc7_ringInit, before the producer is started.
+ */
+void adc7_ringSetTicks( T_adc7_ring *ring, uint32_t *ticks );
+
+/**
+ * @brief Ring Push function
+ *
+ * @param[in] ring  Ring object
+ * @param[in] code  32-bit result
+ *
+ * @returns 0 - Result stored, 1 - Ring is full, result dropped and counted as overrun
+ *
+ * @note
+ * Should be called only from the producer side.
+ */
+uint8_t adc7_ringPush( T_adc7_ring *ring, int32_t code );
+
+/**
+ * @brief Timestamped Ring Push function
+ *
+ * Same as adc7_ringPush, tick is stored if the ring has timestamp storage.
+ */
+uint8_t adc7_ringPushTs( T_adc7_ring *ring, int32_t code, uint32_t tick );
+
+/**
+ * @brief Ring Pop function
+ *
+ * @param[in] ring  Ring object
+ * @param[out] code  Memory where the oldest result be stored
+ *
+ * @returns 0 - Result read, 1 - Ring is empty
+ *
+ * @note
+ * Should be called only from the consumer side.
+ */
+uint8_t adc7_ringPop( T_adc7_ring *ring, int32_t *code );
+
+/**
+ * @brief Timestamped Ring Pop function
+ *
+ * Same as adc7_ringPop, tick is set to 0 if the ring has no timestamp storage.
+ */
+uint8_t adc7_ringPopTs( T_adc7_ring *ring, int32_t *code, uint32_t *tick );
+
+/**
+ * @brief Ring Count function
+ *
+ * @param[in] ring  Ring object
+ *
+ * @returns Number of results waiting in the ring
+ */
+T_adc7_ringIdx adc7_ringCount( T_adc7_ring *ring );
+
+                                                                       /** @} */
+/** @defgroup ADC7_DMA DMA Double Buffered Readout */         /** @{ */
+
+/**
+ * @brief DMA Initialization function
+ *
+ * @param[in] dmaRead  DMA SPI read function
+ * @param[in] buf0  First buffer, nFrames * frameLen bytes
+ * @param[in] buf1  Second buffer, nFrames * frameLen bytes
+ * @param[in] nFrames  Number of results per buffer
+ * @param[in] frameLen  Bytes per result, 4 - 32-bit result, more - result with configuration bytes
+ *
+ * Function prepares ping-pong buffers for DMA readout. While the application processes one buffer,
+ * results are clocked into the other one.
+ */
+void adc7_dmaInit( T_adc7_dmaReadFp dmaRead, uint8_t *buf0, uint8_t *buf1, uint16_t nFrames, uint8_t frameLen );
+
+/**
+ * @brief DMA Timestamp Storage Set function
+ *
+ * @param[in] ticks0  Storage for nFrames timestamps of the first buffer, 0 - frames only
+ * @param[in] ticks1  Storage for nFrames timestamps of the second buffer, 0 - frames only
+ *
+ * Each frame gets the tick taken on the DRL interrupt that started its transfer (see adc7_setTickSource).
+ * @note
+ * Should be called after adc7_dmaInit, which clears the storage.
+ */
+void adc7_dmaSetTicks( uint32_t *ticks0, uint32_t *ticks1 );
+
+/**
+ * @brief DMA Settled Flag Storage Set function
+ *
+ * @param[in] flags0  Storage for nFrames settled flags of the first buffer, 0 - frames only
+ * @param[in] flags1  Storage for nFrames settled flags of the second buffer, 0 - frames only
+ *
+ * Each frame gets 1 if the digital filter was settled when it was produced, 0 if not (see adc7_setSettleMode).
+ * @note
+ * Should be called after adc7_dmaInit, which clears the storage.
+ */
+void adc7_dmaSetSettleFlags( uint8_t *flags0, uint8_t *flags1 );
+
+/**
+ * @brief DMA Capture Start function
+ *
+ * @returns 0 - Capture started, 1 - Previous conversion cycle or the last frame of a stopped capture still in progress
+ *
+ * Function starts continuous interrupt driven conversion cycles. On each DRL falling edge the result frame
+ * is read by DMA and the next conversion cycle starts immediately, overlapping the readout.
+ * @note
+ * adc7_busyIsr, adc7_drlIsr and adc7_dmaIsr should be called from the corresponding interrupts.
+ * The frame should be read before the next result is ready (Down Sampling Factor conversion periods).
+ */
+uint8_t adc7_dmaStart( void );
+
+/**
+ * @brief DMA Capture Stop function
+ *
+ * No new cycles are started. The conversion cycle in progress is finished and its frame is read
+ * into the DMA buffer (unless it is discarded in settling skip mode), the capture is idle once
+ * adc7_dmaIsr handled it.
+ */
+void adc7_dmaStop( void );
+
+/**
+ * @brief DMA Transfer Complete Handler
+ */
+void adc7_dmaIsr( void );
+
+/**
+ * @brief Full Buffer Get function
+ *
+ * @returns Buffer with nFrames results, 0 - no buffer is full yet
+ *
+ * @note
+ * Buffer belongs to the application until adc7_dmaReleaseBuffer is called.
+ */
+uint8_t* adc7_dmaGetBuffer( void );
+
+/**
+ * @brief Full Buffer Timestamps Get function
+ *
+ * @returns Timestamps of the frames of the buffer returned by adc7_dmaGetBuffer, 0 - no buffer is full
+ * yet or no storage is set
+ */
+uint32_t* adc7_dmaGetTicks( void );
+
+/**
+ * @brief Full Buffer Settled Flags Get function
+ *
+ * @returns Settled flags of the frames of the buffer returned by adc7_dmaGetBuffer, 0 - no buffer is full
+ * yet or no storage is set
+ */
+uint8_t* adc7_dmaGetSettleFlags( void );
+
+/**
+ * @brief Buffer Release function
+ */
+void adc7_dmaReleaseBuffer( void );
+
+/**
+ * @brief Frame to Code function
+ *
+ * @param[in] frame  Result frame, first 4 bytes are 32-bit result MSB first
+ *
+ * @returns 32-bit result
+ */
+int32_t adc7_frameToCode( uint8_t *frame );
+
+                                                                       /** @} */
+/** @defgroup ADC7_NYQ Nyquist Output */                      /** @{ */
+
+/**
+ * @brief Nyquist Capture Set function
+ *
+ * @param[in] nyqRead  SDOB read function, 0 - capture disabled
+ * @param[out] buf  Memory where 24-bit sign extended Nyquist words be stored
+ * @param[in] size  Maximum number of words per conversion cycle
+ *
+ * When set, the no-latency 24-bit result of every conversion in the cycle is read from SDOB
+ * right after BUSY falls, by adc7_startConvCycle (bit-banged MCK) or adc7_busyIsr.
+ * The filtered result is read from SDOA as before, so both are taken from the same conversions.
+ * @note
+ * With a pulse train generator, words are captured only in interrupt mode and the SDOB read
+ * should finish within one MCK period.
+ */
+void adc7_setNyquist( T_adc7_nyqReadFp nyqRead, int32_t *buf, uint16_t size );
+
+/**
+ * @brief Nyquist Count Get function
+ *
+ * @returns Number of words captured in the last conversion cycle
+ */
+uint16_t adc7_getNyquistCount( void );
+
+                                                                       /** @} */
+/** @defgroup ADC7_SETTLE Filter Settling */                  /** @{ */
+
+/**
+ * @brief Settling Mode Set function
+ *
+ * @param[in] mode  _ADC7_SETTLE_OFF, _ADC7_SETTLE_SKIP or _ADC7_SETTLE_FLAG
+ *
+ * Every configuration write synchronizes the digital filter, and the first outputs of the
+ * sinc2-4, ssinc and flat passband filters are not settled. The driver counts them from a
+ * per filter table (filter length in output periods, the same at every down sampling factor).
+ *
+ * Skip mode - result read functions return _ADC7_DATA_NOT_SETTLED without storing the result,
+ * batch functions run additional conversion cycles and interrupt mode starts a new cycle
+ * instead of delivering the result.
+ *
+ * Flag mode - results are stored, read functions return _ADC7_DATA_NOT_SETTLED for unsettled
+ * ones. Batch functions store all results, adc7_getSettleCount called before a batch gives
+ * the number of leading unsettled results. Result callback may check adc7_ctxIsSettled.
+ * DMA capture - in skip mode unsettled results are clocked out by the CPU and discarded, they take
+ * no place in the buffers. In the other modes every frame is stored, see adc7_dmaSetSettleFlags.
+ */
+void adc7_setSettleMode( uint8_t mode );
+
+/**
+ * @brief Settle Count Get function
+ *
+ * @returns Number of upcoming outputs which are not settled
+ */
+uint8_t adc7_getSettleCount( void );
+
+/**
+ * @brief Settled Check function
+ *
+ * @returns 1 - last result read was settled, 0 - not settled
+ */
+uint8_t adc7_isSettled( void );
+
+                                                                       /** @} */
+/** @defgroup ADC7_TLM Telemetry Frames */                    /** @{ */
+
+/**
+ * @brief Telemetry Frame function
+ *
+ * @param[in] codes  Raw codes, as returned by the batch functions
+ * @param[in] ticks  Timestamps of the codes, 0 - not available
+ * @param[in] nCodes  Number of codes (1 - _ADC7_TLM_CODES_MAX)
+ * @param[out] frame  Memory where the encoded frame be stored, _ADC7_TLM_FRAME_MAX( nCodes ) bytes
+ * @returns Frame length in bytes, 0 - wrong number of codes
+ *
+ * Packs a batch of codes into one binary frame for the log UART or any byte stream,
+ * instead of formatting every sample as text. Packet fields, multi-byte ones little endian :
+ *
+ * | Offset | Size | Field                                               |
+ * |:------:|:----:|:----------------------------------------------------|
+ * | 0      | 1    | _ADC7_TLM_VERSION                                   |
+ * | 1      | 2    | Sequence number, incremented per frame              |
+ * | 3      | 2    | Configuration word last written to the device       |
+ * | 5      | 4    | Timestamp of the first code                         |
+ * | 9      | 4    | Timestamp of the last code                          |
+ * | 13     | 1    | Number of codes n                                   |
+ * | 14     | 4n   | Codes                                               |
+ * | 14+4n  | 2    | CRC-16/CCITT-FALSE of all preceding bytes            |
+ *
+ * The packet is COBS encoded and terminated with a 0x00 delimiter, so a receiver resynchronizes
+ * on the next zero byte after a lost or corrupted byte. Gaps in the sequence number show
+ * dropped frames. The configuration word is 0 before the first adc7_setConfig.
+ */
+uint16_t adc7_tlmFrame( int32_t *codes, uint32_t *ticks, uint8_t nCodes, uint8_t *frame );
+
+                                                                       /** @} */
+#ifdef __ADC7_STATS__
+/** @defgroup ADC7_STATS Instrumentation */                   /** @{ */
+
+/**
+ * @brief Statistics Get function
+ *
+ * @param[out] stats  Memory where snapshot of the counters be stored
+ *
+ * @note
+ * Counters updated from interrupts may change during the copy, take the snapshot while acquisition is idle
+ * if exact consistency is required.
+ */
+void adc7_getStats( T_adc7_stats *stats );
+
+/**
+ * @brief Statistics Reset function
+ */
+void adc7_resetStats( void );
+
+                                                                       /** @} */
+#endif
+/** @defgroup ADC7_CTX Instance Functions */                  /** @{ */
+
+/**
+ * @name Instance Functions
+ *
+ * Same as the functions above, performed on the given driver instance.
+ */
+uint8_t adc7_ctxSetConfig( T_adc7_ctx *ctx, uint8_t gainConfig, uint8_t downSampFactor, uint8_t filterType );
+uint8_t adc7_ctxCheckDataReady( T_adc7_ctx *ctx );
+uint8_t adc7_ctxCheckBusy( T_adc7_ctx *ctx );
+void adc7_ctxSetClock( T_adc7_ctx *ctx, uint8_t state );
+void adc7_ctxPresetMode( T_adc7_ctx *ctx, uint8_t state );
+uint8_t adc7_ctxReadBytes( T_adc7_ctx *ctx, uint8_t nBytes, uint8_t *dataOut );
+uint8_t adc7_ctxStartConvCycle( T_adc7_ctx *ctx );
+uint8_t adc7_ctxReadCodesBatch( T_adc7_ctx *ctx, int32_t *codes, uint16_t nSamples );
+uint8_t adc7_ctxReadResultsBatch( T_adc7_ctx *ctx, int32_t *microVolts, uint16_t nSamples );
+uint8_t adc7_ctxReadCodesBatchTs( T_adc7_ctx *ctx, int32_t *codes, uint32_t *ticks, uint16_t nSamples );
+uint8_t adc7_ctxWaitDataReady( T_adc7_ctx *ctx );
+void adc7_ctxSetTimeout( T_adc7_ctx *ctx, uint32_t polls, uint8_t recover );
+void adc7_ctxSetTickSource( T_adc7_ctx *ctx, T_adc7_tickFp tick );
+uint32_t adc7_ctxGetTimestamp( T_adc7_ctx *ctx );
+uint8_t adc7_ctxStartAcquisition( T_adc7_ctx *ctx );
+uint8_t adc7_ctxPoll( T_adc7_ctx *ctx, int32_t *code );
+#ifdef __ADC7_STATS__
+void adc7_ctxGetStats( T_adc7_ctx *ctx, T_adc7_stats *stats );
+void adc7_ctxResetStats( T_adc7_ctx *ctx );
+#endif
+uint8_t adc7_ctxReadAndConfig( T_adc7_ctx *ctx, uint8_t gainConfig, uint8_t downSampFactor, uint8_t filterType, int32_t *code );
+uint8_t adc7_ctxReadSample( T_adc7_ctx *ctx, T_adc7_sample *sample );
+uint8_t adc7_ctxReadResults( T_adc7_ctx *ctx, int16_t *voltage );
+uint8_t adc7_ctxReadResultsUv( T_adc7_ctx *ctx, int32_t *microVolts );
+uint8_t adc7_ctxReadResultsNv( T_adc7_ctx *ctx, int64_t *nanoVolts );
+int32_t adc7_ctxCodeToMicroVolts( T_adc7_ctx *ctx, int32_t code );
+int64_t adc7_ctxCodeToNanoVolts( T_adc7_ctx *ctx, int32_t code );
+void adc7_ctxSetPulseTrain( T_adc7_ctx *ctx, T_adc7_pulseTrainFp pulseTrain, uint32_t rate );
+void adc7_ctxSetResultCallback( T_adc7_ctx *ctx, T_adc7_resultFp resultCb );
+uint8_t adc7_ctxStartConvIrq( T_adc7_ctx *ctx );
+void adc7_ctxBusyIsr( T_adc7_ctx *ctx );
+void adc7_ctxDrlIsr( T_adc7_ctx *ctx );
+void adc7_ctxAttachRing( T_adc7_ctx *ctx, T_adc7_ring *ring );
+void adc7_ctxDmaInit( T_adc7_ctx *ctx, T_adc7_dmaReadFp dmaRead, uint8_t *buf0, uint8_t *buf1, uint16_t nFrames, uint8_t frameLen );
+uint8_t adc7_ctxDmaStart( T_adc7_ctx *ctx );
+void adc7_ctxDmaStop( T_adc7_ctx *ctx );
+void adc7_ctxDmaIsr( T_adc7_ctx *ctx );
+uint8_t* adc7_ctxDmaGetBuffer( T_adc7_ctx *ctx );
+void adc7_ctxDmaSetTicks( T_adc7_ctx *ctx, uint32_t *ticks0, uint32_t *ticks1 );
+uint32_t* adc7_ctxDmaGetTicks( T_adc7_ctx *ctx );
+void adc7_ctxDmaSetSettleFlags( T_adc7_ctx *ctx, uint8_t *flags0, uint8_t *flags1 );
+uint8_t* adc7_ctxDmaGetSettleFlags( T_adc7_ctx *ctx );
+void adc7_ctxDmaReleaseBuffer( T_adc7_ctx *ctx );
+void adc7_ctxSetNyquist( T_adc7_ctx *ctx, T_adc7_nyqReadFp nyqRead, int32_t *buf, uint16_t size );
+uint16_t adc7_ctxGetNyquistCount( T_adc7_ctx *ctx );
+void adc7_ctxSetSettleMode( T_adc7_ctx *ctx, uint8_t mode );
+uint8_t adc7_ctxGetSettleCount( T_adc7_ctx *ctx );
+uint8_t adc7_ctxIsSettled( T_adc7_ctx *ctx );
+uint16_t adc7_ctxTlmFrame( T_adc7_ctx *ctx, int32_t *codes, uint32_t *ticks, uint8_t nCodes, uint8_t *frame );
+
                                                                        /** @} */
 #ifdef __cplusplus
 } // extern "C"
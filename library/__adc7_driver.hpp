@@ -0,0 +1,569 @@
+/*
+    __adc7_driver.hpp
+
+-----------------------------------------------------------------------------
+
+  This file is part of mikroSDK.
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+----------------------------------------------------------------------------- */
+
+/**
+@file   __adc7_driver.hpp
+@brief    ADC_7 C++ Driver
+*/
+/**
+@defgroup   ADC7_CPP
+@brief      ADC_7 Click header-only C++ driver
+@{
+
+| Global Library Prefix | **adc7::**         |
+|:---------------------:|:------------------:|
+| Version               | **1.0.0**          |
+| Date                  | **Oct 2026.**      |
+| Developer             | **MikroE FW Team** |
+
+Same operations as the blocking part of __adc7_driver.h, with the HAL given as a compile-time
+policy instead of the function pointer tables filled by hal_gpioMap/hal_spiMap. Pin accesses are
+static calls, so MCK toggles and BUSY polls are inlined down to the policy implementation
+(direct port register access on the target).
+
+The HAL policy is a class with static members:
+
+@code
+struct MyHal
+{
+    static void mckSet( uint8_t state );             // PWM pin
+    static void preSet( uint8_t state );             // RST pin
+    static void csSet( uint8_t state );              // CS pin
+    static uint8_t busyGet();                        // INT pin
+    static uint8_t drlGet();                         // AN pin
+    static uint8_t spiTransfer( uint8_t input );     // one SPI byte, full duplex
+    static void delayUs();                           // 1 us delay
+};
+
+adc7::Adc7< MyHal > adc;
+
+adc.init();
+@endcode
+
+Interrupt driven, DMA, ring and non-blocking acquisition remain in the C driver, they depend
+on target specific interrupt and DMA setup.
+
+*/
+/* -------------------------------------------------------------------------- */
+
+#include "stdint.h"
+#include "__adc7_scale.h"
+
+#ifndef _ADC7_DRIVER_HPP_
+#define _ADC7_DRIVER_HPP_
+
+namespace adc7
+{
+
+/** @defgroup ADC7_CPP_VAR Variables */                       /** @{ */
+
+/** Filter Type */
+static const uint8_t SINC1_FILT                 = 0x01;
+static const uint8_t SINC2_FILT                 = 0x02;
+static const uint8_t SINC3_FILT                 = 0x03;
+static const uint8_t SINC4_FILT                 = 0x04;
+static const uint8_t SSINC_FILT                 = 0x05;
+static const uint8_t FLAT_PASSBAND_FILT         = 0x06;
+static const uint8_t AVERAGING_FILT             = 0x07;
+
+/** Down Sampling Factor */
+static const uint8_t DOWNSAMPL_FACT_4           = 0x02;
+static const uint8_t DOWNSAMPL_FACT_8           = 0x03;
+static const uint8_t DOWNSAMPL_FACT_16          = 0x04;
+static const uint8_t DOWNSAMPL_FACT_32          = 0x05;
+static const uint8_t DOWNSAMPL_FACT_64          = 0x06;
+static const uint8_t DOWNSAMPL_FACT_128         = 0x07;
+static const uint8_t DOWNSAMPL_FACT_256         = 0x08;
+static const uint8_t DOWNSAMPL_FACT_512         = 0x09;
+static const uint8_t DOWNSAMPL_FACT_1024        = 0x0A;
+static const uint8_t DOWNSAMPL_FACT_2048        = 0x0B;
+static const uint8_t DOWNSAMPL_FACT_4096        = 0x0C;
+static const uint8_t DOWNSAMPL_FACT_8192        = 0x0D;
+static const uint8_t DOWNSAMPL_FACT_16384       = 0x0E;
+
+/** Gain Configuration */
+static const uint8_t GAIN_EXPAN_EN              = 0x01;
+static const uint8_t GAIN_COMPR_EN              = 0x02;
+static const uint8_t GAIN_DISABLE               = 0x00;
+
+/** Status, same values as the C driver */
+static const uint8_t DATA_NOT_READY             = 0x01;
+static const uint8_t DATA_IS_READY              = 0x00;
+static const uint8_t DEVICE_IS_BUSY             = 0x01;
+static const uint8_t DEVICE_NOT_BUSY            = 0x00;
+static const uint8_t WRONG_GAIN_CONFIG          = 0x02;
+static const uint8_t WRONG_DOWNSAMPL_FACT       = 0x03;
+static const uint8_t WRONG_FILT_TYPE            = 0x04;
+static const uint8_t WRONG_FRAME                = 0x05;
+static const uint8_t TIMEOUT                    = 0x08;
+
+static const uint8_t HIGH_STATE                 = 0x01;
+static const uint8_t LOW_STATE                  = 0x00;
+
+                                                                       /** @} */
+/** @defgroup ADC7_CPP_TYPES Types */                         /** @{ */
+
+/** Result with the configuration echoed in the extended readout */
+struct Sample
+{
+    int32_t     code;
+    uint8_t     gainConfig;
+    uint8_t     downSampFactor;
+    uint8_t     filterType;
+};
+
+/** Per gain configuration constants, see __adc7_scale.h */
+struct GainCfg
+{
+    float       voltRef;
+    uint32_t    valueLSB;
+    uint32_t    scaleUv;
+    uint64_t    scaleNv;
+};
+
+template< class Dummy >
+struct Tables
+{
+    static const GainCfg    gainCfg[ 4 ];
+    static const uint16_t   numSampl[ 13 ];
+};
+
+template< class Dummy >
+const GainCfg Tables< Dummy >::gainCfg[ 4 ] = _ADC7_GAIN_CFG_INIT;
+
+template< class Dummy >
+const uint16_t Tables< Dummy >::numSampl[ 13 ] = _ADC7_NUM_SAMPL_INIT;
+
+                                                                       /** @} */
+/** @defgroup ADC7_CPP_SCALE Scaling */                       /** @{ */
+
+/**
+ * @brief Code to Microvolts function, see adc7_codeToMicroVolts
+ *
+ * @param[in] code  Raw code
+ * @param[in] gainConfig  Gain configuration of the conversion (0 - 3)
+ */
+inline int32_t codeToMicroVolts( int32_t code, uint8_t gainConfig )
+{
+    return _adc7_scaleUv( code, Tables< void >::gainCfg[ gainConfig & 0x03 ].scaleUv );
+}
+
+/**
+ * @brief Code to Nanovolts function, see adc7_codeToNanoVolts
+ *
+ * @param[in] code  Raw code
+ * @param[in] gainConfig  Gain configuration of the conversion (0 - 3)
+ */
+inline int64_t codeToNanoVolts( int32_t code, uint8_t gainConfig )
+{
+    return _adc7_scaleNv( code, Tables< void >::gainCfg[ gainConfig & 0x03 ].scaleNv );
+}
+
+                                                                       /** @} */
+/** @defgroup ADC7_CPP_CLASS Driver Class */                  /** @{ */
+
+template< class Hal >
+class Adc7
+{
+public:
+
+    /**
+     * @brief Constructor
+     *
+     * Does not access the HAL, so objects may be defined before the pins and the bus are ready.
+     * init must be called before any other function.
+     */
+    Adc7()
+        : _numSampl( 4 ), _gain( 0 ), _cfgValid( 0 ), _timeout( 0 )
+    {
+    }
+
+    /**
+     * @brief Initialization function
+     *
+     * Same as adc7_spiDriverInit, the bus itself is set up by the HAL policy.
+     */
+    void init()
+    {
+        Hal::csSet( 1 );
+        Hal::preSet( 0 );
+        Hal::mckSet( 0 );
+
+        _numSampl = 4;
+        _gain = 0;
+        _cfgValid = 0;
+        _timeout = 0;
+    }
+
+    /** @brief Configuration Set function, see adc7_setConfig */
+    uint8_t setConfig( uint8_t gainConfig, uint8_t downSampFactor, uint8_t filterType )
+    {
+        uint8_t cfg[ 2 ];
+        uint8_t status;
+
+        status = makeConfig( gainConfig, downSampFactor, filterType, cfg );
+        if (status)
+        {
+            return status;
+        }
+        if (_cfgValid && (_cfgShadow[ 0 ] == cfg[ 0 ]) && (_cfgShadow[ 1 ] == cfg[ 1 ]))
+        {
+            return DEVICE_NOT_BUSY;
+        }
+        if (Hal::busyGet())
+        {
+            return DEVICE_IS_BUSY;
+        }
+
+        Hal::csSet( 0 );
+        Hal::spiTransfer( cfg[ 0 ] );
+        Hal::spiTransfer( cfg[ 1 ] );
+        Hal::csSet( 1 );
+
+        _cfgShadow[ 0 ] = cfg[ 0 ];
+        _cfgShadow[ 1 ] = cfg[ 1 ];
+        _cfgValid = 1;
+
+        return DEVICE_NOT_BUSY;
+    }
+
+    /** @brief Data Ready Check function, see adc7_checkDataReady */
+    uint8_t checkDataReady()
+    {
+        return Hal::drlGet() ? DATA_NOT_READY : DATA_IS_READY;
+    }
+
+    /** @brief Busy Check function, see adc7_checkBusy */
+    uint8_t checkBusy()
+    {
+        return Hal::busyGet() ? DEVICE_IS_BUSY : DEVICE_NOT_BUSY;
+    }
+
+    /** @brief Clock Set function, see adc7_setClock */
+    void setClock( uint8_t state )
+    {
+        Hal::mckSet( state ? 1 : 0 );
+    }
+
+    /** @brief Preset Mode function, see adc7_presetMode */
+    void presetMode( uint8_t state )
+    {
+        _cfgValid = 0;
+        Hal::preSet( state ? 1 : 0 );
+    }
+
+    /** @brief Bytes Read function, see adc7_readBytes */
+    uint8_t readBytes( uint8_t nBytes, uint8_t *dataOut )
+    {
+        if (Hal::drlGet())
+        {
+            return DATA_NOT_READY;
+        }
+
+        Hal::csSet( 0 );
+        while (nBytes--)
+        {
+            *( dataOut++ ) = Hal::spiTransfer( 0x00 );
+        }
+        Hal::csSet( 1 );
+
+        return DATA_IS_READY;
+    }
+
+    /** @brief Start Conversion function, see adc7_startConvCycle */
+    uint8_t startConvCycle()
+    {
+        uint16_t count;
+
+        for (count = 0; count < _numSampl; count++)
+        {
+            Hal::mckSet( 1 );
+            Hal::delayUs();
+            Hal::mckSet( 0 );
+            Hal::delayUs();
+
+            if (waitBusy())
+            {
+                return TIMEOUT;
+            }
+        }
+
+        return DATA_IS_READY;
+    }
+
+    /** @brief Data Ready Wait function, see adc7_waitDataReady */
+    uint8_t waitDataReady()
+    {
+        uint32_t polls = _timeout;
+
+        while (Hal::drlGet())
+        {
+            if (polls && !--polls)
+            {
+                return TIMEOUT;
+            }
+        }
+
+        return DATA_IS_READY;
+    }
+
+    /** @brief Timeout Set function, see adc7_setTimeout (no recovery sequence) */
+    void setTimeout( uint32_t polls )
+    {
+        _timeout = polls;
+    }
+
+    /** @brief Results Read function (mV), see adc7_readResults */
+    uint8_t readResults( int16_t *voltage )
+    {
+        uint8_t buffData[ 4 ];
+        double temp;
+
+        if (readBytes( 4, buffData ))
+        {
+            return DATA_NOT_READY;
+        }
+
+        temp = (double)toCode( buffData ) / Tables< void >::gainCfg[ _gain ].valueLSB;
+        temp *= Tables< void >::gainCfg[ _gain ].voltRef;
+        *voltage = (int16_t)temp;
+
+        return DATA_IS_READY;
+    }
+
+    /** @brief Results Read function (uV), see adc7_readResultsUv */
+    uint8_t readResultsUv( int32_t *microVolts )
+    {
+        uint8_t buffData[ 4 ];
+
+        if (readBytes( 4, buffData ))
+        {
+            return DATA_NOT_READY;
+        }
+
+        *microVolts = codeToMicroVolts( toCode( buffData ) );
+
+        return DATA_IS_READY;
+    }
+
+    /** @brief Results Read function (nV), see adc7_readResultsNv */
+    uint8_t readResultsNv( int64_t *nanoVolts )
+    {
+        uint8_t buffData[ 4 ];
+
+        if (readBytes( 4, buffData ))
+        {
+            return DATA_NOT_READY;
+        }
+
+        *nanoVolts = codeToNanoVolts( toCode( buffData ) );
+
+        return DATA_IS_READY;
+    }
+
+    /** @brief Code to Microvolts function, see adc7_codeToMicroVolts */
+    int32_t codeToMicroVolts( int32_t code ) const
+    {
+        return adc7::codeToMicroVolts( code, _gain );
+    }
+
+    /** @brief Code to Nanovolts function, see adc7_codeToNanoVolts */
+    int64_t codeToNanoVolts( int32_t code ) const
+    {
+        return adc7::codeToNanoVolts( code, _gain );
+    }
+
+    /** @brief Batch Codes Read function, see adc7_readCodesBatch */
+    uint8_t readCodesBatch( int32_t *codes, uint16_t nSamples )
+    {
+        uint8_t buffData[ 4 ];
+
+        while (nSamples--)
+        {
+            if (startConvCycle() || waitDataReady())
+            {
+                return TIMEOUT;
+            }
+
+            readBytes( 4, buffData );
+            *( codes++ ) = toCode( buffData );
+        }
+
+        return DATA_IS_READY;
+    }
+
+    /** @brief Read And Configure function, see adc7_readAndConfig */
+    uint8_t readAndConfig( uint8_t gainConfig, uint8_t downSampFactor, uint8_t filterType, int32_t *code )
+    {
+        uint8_t cfg[ 2 ];
+        uint8_t buffData[ 4 ];
+        uint8_t status;
+
+        if (Hal::drlGet())
+        {
+            return DATA_NOT_READY;
+        }
+
+        status = makeConfig( gainConfig, downSampFactor, filterType, cfg );
+        if (status)
+        {
+            return status;
+        }
+
+        if (_cfgValid && (_cfgShadow[ 0 ] == cfg[ 0 ]) && (_cfgShadow[ 1 ] == cfg[ 1 ]))
+        {
+            cfg[ 0 ] = 0x00;
+            cfg[ 1 ] = 0x00;
+        }
+        else
+        {
+            _cfgShadow[ 0 ] = cfg[ 0 ];
+            _cfgShadow[ 1 ] = cfg[ 1 ];
+            _cfgValid = 1;
+        }
+
+        Hal::csSet( 0 );
+        buffData[ 0 ] = Hal::spiTransfer( cfg[ 0 ] );
+        buffData[ 1 ] = Hal::spiTransfer( cfg[ 1 ] );
+        buffData[ 2 ] = Hal::spiTransfer( 0x00 );
+        buffData[ 3 ] = Hal::spiTransfer( 0x00 );
+        Hal::csSet( 1 );
+
+        *code = toCode( buffData );
+
+        return DATA_IS_READY;
+    }
+
+    /** @brief Tagged Sample Read function, see adc7_readSample */
+    uint8_t readSample( Sample *sample )
+    {
+        uint8_t buffData[ 6 ];
+
+        if (readBytes( 6, buffData ))
+        {
+            return DATA_NOT_READY;
+        }
+
+        return decodeFrame( buffData, sample );
+    }
+
+    /** @brief Extended Frame Decode function, see adc7_decodeFrame */
+    static uint8_t decodeFrame( const uint8_t *frame, Sample *sample )
+    {
+        if (_adc7_frameTrailer( (uint8_t *)frame, &sample->gainConfig, &sample->downSampFactor, &sample->filterType ))
+        {
+            return WRONG_FRAME;
+        }
+
+        sample->code = toCode( frame );
+
+        return DATA_IS_READY;
+    }
+
+    /** @brief Frame to Code function, see adc7_frameToCode */
+    static int32_t toCode( const uint8_t *frame )
+    {
+        return _adc7_frameCode( (uint8_t *)frame );
+    }
+
+private:
+
+    uint8_t makeConfig( uint8_t gainConfig, uint8_t downSampFactor, uint8_t filterType, uint8_t *cfg )
+    {
+        if (gainConfig > 3)
+        {
+            return WRONG_GAIN_CONFIG;
+        }
+        if ((downSampFactor < 2) || (downSampFactor > 14))
+        {
+            return WRONG_DOWNSAMPL_FACT;
+        }
+        if ((filterType < 1) || (filterType > 7))
+        {
+            return WRONG_FILT_TYPE;
+        }
+
+        cfg[ 0 ] = 0x80 | (gainConfig << 4) | downSampFactor;
+        cfg[ 1 ] = filterType << 4;
+
+        _numSampl = Tables< void >::numSampl[ downSampFactor - 2 ];
+        _gain = gainConfig;
+
+        return 0;
+    }
+
+    uint8_t waitBusy()
+    {
+        uint32_t polls = _timeout;
+
+        while (Hal::busyGet())
+        {
+            if (polls && !--polls)
+            {
+                return TIMEOUT;
+            }
+        }
+
+        return DEVICE_NOT_BUSY;
+    }
+
+    uint16_t    _numSampl;
+    uint8_t     _gain;
+    uint8_t     _cfgShadow[ 2 ];
+    uint8_t     _cfgValid;
+    uint32_t    _timeout;
+};
+
+                                                                       /** @} */
+} // namespace adc7
+
+#endif
+                                                                       /** @} */
+/* -------------------------------------------------------------------------- */
+/*
+  __adc7_driver.hpp
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+3. All advertising materials mentioning features or use of this software
+   must display the following acknowledgement:
+   This product includes software developed by the MikroElektonika.
+
+4. Neither the name of the MikroElektonika nor the
+   names of its contributors may be used to endorse or promote products
+   derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY MIKROELEKTRONIKA ''AS IS'' AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL MIKROELEKTRONIKA BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------------- */
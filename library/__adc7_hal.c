@@ -46,6 +46,7 @@
                  #define   __HAL_SPI__                            /**<     @macro __HAL_SPI__  @brief SPI HAL selector */                
 //                #define   __HAL_I2C__                            /**<     @macro __HAL_I2C__  @brief I2C HAL selector */
 //               #define   __HAL_UART__                           /**<     @macro __HAL_UART__  @brief UART HAL selector */                          
+//               #define   __HAL_GPIO_STATIC__                    /**<     @macro __HAL_GPIO_STATIC__  @brief GPIO accessors bound to the pins at compile time (see below) */
 
   #define   __AN_PIN_INPUT__          0
 // #define   __RST_PIN_INPUT__         1
@@ -105,6 +106,7 @@ static void hal_spiWrite(uint8_t *pBuf, uint16_t nBytes);
  *
  * @note
  * This function should not use CS pin.
+ * Dummy byte 0x00 should be sent for every byte read.
  */
 static void hal_spiRead(uint8_t *pBuf, uint16_t nBytes);
 
@@ -242,6 +244,7 @@ typedef struct
   
 }T_hal_gpioObj;
 
+#ifndef __HAL_GPIO_STATIC__
 #ifdef __AN_PIN_INPUT__
 static T_hal_gpioGetFp          hal_gpio_anGet; 
 #endif
@@ -395,6 +398,65 @@ static void hal_gpioMap(T_HAL_P gpioObj)
     hal_gpio_sdaSet = tmp->gpioSet[ __SDA_PIN_OUTPUT__ ];
 #endif
 }
+#else
+#if defined( __MIKROC_PRO_FOR_PIC__ ) || defined( __MIKROC_PRO_FOR_PIC32__ ) || \
+    defined( __MIKROC_PRO_FOR_DSPIC__ ) || defined( __MIKROC_PRO_FOR_AVR__ ) || \
+    defined( __MIKROC_PRO_FOR_FT90x__ ) || defined( __MIKROC_PRO_FOR_ARM__ )
+
+/*
+ * The application binds the mikroBUS pins of the slot used to port bits, input pins to the
+ * port register and output pins to the latch / output data register, e.g. on STM32 mikroBUS 1:
+ *
+ * sbit ADC7_AN  at GPIOA_IDR.B4;
+ * sbit ADC7_INT at GPIOD_IDR.B10;
+ * sbit ADC7_RST at GPIOC_ODR.B2;
+ * sbit ADC7_CS  at GPIOD_ODR.B13;
+ * sbit ADC7_PWM at GPIOD_ODR.B12;
+ */
+extern sfr sbit ADC7_AN;
+extern sfr sbit ADC7_INT;
+extern sfr sbit ADC7_RST;
+extern sfr sbit ADC7_CS;
+extern sfr sbit ADC7_PWM;
+
+#define hal_gpio_anGet()        (ADC7_AN)
+#define hal_gpio_intGet()       (ADC7_INT)
+#define hal_gpio_rstSet(state)  (ADC7_RST = (state))
+#define hal_gpio_csSet(state)   (ADC7_CS = (state))
+#define hal_gpio_pwmSet(state)  (ADC7_PWM = (state))
+
+#elif defined( __linux__ )
+
+/*
+ * Bound to mikroBUS __HAL_GPIO_SLOT__ (1 or 2) of the simulator, the direct pin functions take
+ * the place of port register accesses, without the indirect call of the mapped pointers.
+ */
+#ifndef __HAL_GPIO_SLOT__
+#define __HAL_GPIO_SLOT__       1
+#endif
+
+#define hal_gpio_anGet()        adc7sim_drlGet( __HAL_GPIO_SLOT__ - 1 )
+#define hal_gpio_intGet()       adc7sim_busyGet( __HAL_GPIO_SLOT__ - 1 )
+#define hal_gpio_rstSet(state)  adc7sim_preSet( __HAL_GPIO_SLOT__ - 1, (state) )
+#define hal_gpio_csSet(state)   adc7sim_csSet( __HAL_GPIO_SLOT__ - 1, (state) )
+#define hal_gpio_pwmSet(state)  adc7sim_mckSet( __HAL_GPIO_SLOT__ - 1, (state) )
+
+#else
+#error "__HAL_GPIO_STATIC__ : no static GPIO binding for this target, use the mapped accessors"
+#endif
+
+/**
+ * @brief Map GPIO Function pointers
+ *
+ * hal_gpio_* accessors are bound to the pins at compile time above,
+ * nothing is mapped at runtime and gpioObj is ignored.
+ */
+static void hal_gpioMap(T_HAL_P gpioObj)
+{
+    (void)gpioObj;
+}
+
+#endif
                                                                        /** @} */
 #ifdef __MIKROC_PRO_FOR_PIC__
 #include "__HAL_PIC.c"
@@ -448,6 +510,10 @@ static void hal_gpioMap(T_HAL_P gpioObj)
 #endif
 #endif
 
+#ifdef __linux__
+#include "__HAL_LINUX.c"
+#endif
+
 /* -------------------------------------------------------------------------- */
 /*
   __adc7_hal.c
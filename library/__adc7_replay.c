@@ -0,0 +1,204 @@
+/*
+    __adc7_replay.c
+
+-----------------------------------------------------------------------------
+
+  This file is part of mikroSDK.
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+----------------------------------------------------------------------------- */
+
+#include <string.h>
+#include "__adc7_replay.h"
+#include "__adc7_sim.h"
+
+/* ---------------------------------------------------------------- VARIABLES */
+
+typedef struct
+{
+    T_adc7cap_reader    capture;
+    uint8_t             mode;
+    uint64_t            next;            /**< Next code to deliver */
+    uint8_t             started;         /**< Recorded mode time base taken */
+    uint64_t            startNs;         /**< Virtual time of the first replayed output */
+    uint64_t            startTick;       /**< Recorded time of the first replayed output */
+    T_adc7replay_stats  stats;
+
+}T_adc7replay;
+
+static T_adc7replay _replay[ _ADC7SIM_SLOTS ];
+
+/* -------------------------------------------- PRIVATE FUNCTION DECLARATIONS */
+
+static uint8_t _output( uint8_t slot, int32_t *code, uint64_t *drlNs );
+static uint64_t _ticksToNs( uint64_t ticks, uint32_t tickHz );
+
+/* --------------------------------------------- PRIVATE FUNCTION DEFINITIONS */
+
+/*
+ * Whole seconds and the remainder are scaled separately, exact without 128-bit math.
+ * Ticks are taken as ns when the rate is not known.
+ */
+static uint64_t _ticksToNs( uint64_t ticks, uint32_t tickHz )
+{
+    if (!tickHz)
+    {
+        return ticks;
+    }
+
+    return (ticks / tickHz) * 1000000000 + (ticks % tickHz) * 1000000000 / tickHz;
+}
+
+static uint8_t _output( uint8_t slot, int32_t *code, uint64_t *drlNs )
+{
+    T_adc7replay *replay = &_replay[ slot ];
+    const T_adc7cap_header *header = replay->capture.header;
+    uint64_t tick;
+    uint64_t now;
+    uint8_t cfg[ 2 ];
+
+    if (replay->next >= header->nSamples)
+    {
+        return 1;
+    }
+
+    adc7sim_getConfig( slot, cfg );
+    if ((((cfg[ 0 ] >> 4) & 0x03) != header->gainConfig) || ((cfg[ 0 ] & 0x0F) != header->downSampFactor) ||
+        ((cfg[ 1 ] >> 4) != header->filterType))
+    {
+        replay->stats.mismatches++;
+    }
+
+    *code = replay->capture.codes[ replay->next ];
+
+    if (replay->mode == _ADC7REPLAY_RECORDED)
+    {
+        now = adc7sim_now();
+        tick = adc7cap_sampleTime( &replay->capture, replay->next );
+
+        if (!replay->started)
+        {
+            replay->started = 1;
+            replay->startNs = now;
+            replay->startTick = tick;
+        }
+
+        *drlNs = replay->startNs + _ticksToNs( tick - replay->startTick, header->tickHz );
+
+        if (*drlNs < now)
+        {
+            replay->stats.late++;
+        }
+    }
+
+    replay->next++;
+    replay->stats.delivered++;
+
+    return 0;
+}
+
+/* --------------------------------------------------------- PUBLIC FUNCTIONS */
+
+uint8_t adc7replay_open( uint8_t slot, const char *path, uint8_t mode )
+{
+    T_adc7replay *replay;
+    uint8_t status;
+
+    if ((slot >= _ADC7SIM_SLOTS) || (mode > _ADC7REPLAY_RECORDED))
+    {
+        return _ADC7CAP_ERR_PARAM;
+    }
+
+    adc7replay_close( slot );
+    replay = &_replay[ slot ];
+
+    status = adc7cap_map( &replay->capture, path );
+    if (status)
+    {
+        return status;
+    }
+
+    replay->mode = mode;
+    memset( &replay->stats, 0, sizeof( T_adc7replay_stats ) );
+    adc7replay_seek( slot, 0 );
+    adc7sim_setOutputFn( slot, _output );
+
+    return _ADC7CAP_OK;
+}
+
+void adc7replay_close( uint8_t slot )
+{
+    if (_replay[ slot ].capture.base)
+    {
+        adc7sim_setOutputFn( slot, 0 );
+        adc7cap_unmap( &_replay[ slot ].capture );
+    }
+}
+
+const T_adc7cap_reader* adc7replay_capture( uint8_t slot )
+{
+    return &_replay[ slot ].capture;
+}
+
+void adc7replay_seek( uint8_t slot, uint64_t sample )
+{
+    _replay[ slot ].next = sample;
+    _replay[ slot ].started = 0;
+}
+
+uint8_t adc7replay_done( uint8_t slot )
+{
+    if (!_replay[ slot ].capture.base)
+    {
+        return 1;
+    }
+
+    return _replay[ slot ].next >= _replay[ slot ].capture.header->nSamples;
+}
+
+void adc7replay_getStats( uint8_t slot, T_adc7replay_stats *stats )
+{
+    *stats = _replay[ slot ].stats;
+}
+
+/* -------------------------------------------------------------------------- */
+/*
+  __adc7_replay.c
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+3. All advertising materials mentioning features or use of this software
+   must display the following acknowledgement:
+   This product includes software developed by the MikroElektonika.
+
+4. Neither the name of the MikroElektonika nor the
+   names of its contributors may be used to endorse or promote products
+   derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY MIKROELEKTRONIKA ''AS IS'' AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL MIKROELEKTRONIKA BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------------- */
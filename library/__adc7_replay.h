@@ -0,0 +1,179 @@
+/*
+    __adc7_replay.h
+
+-----------------------------------------------------------------------------
+
+  This file is part of mikroSDK.
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+----------------------------------------------------------------------------- */
+
+/**
+@file   __adc7_replay.h
+@brief    ADC_7 Capture Replay
+*/
+/**
+@defgroup   ADC7_REPLAY
+@brief      Replays capture files through the simulated device (Linux)
+@{
+
+| Global Library Prefix | **ADC7REPLAY**     |
+|:---------------------:|:------------------:|
+| Version               | **1.0.0**          |
+| Date                  | **Oct 2026.**      |
+| Developer             | **MikroE FW Team** |
+
+The recorded codes become the filter outputs of a simulated slot, so they are read back
+through the unchanged driver and Linux HAL (hal_spiTransfer, DRL on AN, BUSY on INT) by
+adc7_readResults, the batch, interrupt, ring and DMA paths alike.
+
+- _ADC7REPLAY_FAST - every output is available as soon as its conversion cycle ends, for
+  regression runs and profiling as fast as the driver goes.
+- _ADC7REPLAY_RECORDED - DRL of every output falls no earlier than its recorded time
+  (relative to the first replayed output, in virtual time). Recorded times are the per-sample
+  timestamps stored in the capture, so gaps and jitter are replayed as they were captured.
+  Outputs are delayed, never dropped, when the driver is slower.
+
+The capture holds output times only (the ticks the recording driver took when it saw DRL low),
+MCK/BUSY timing of the conversions is modelled as usual.
+The application configures the device with the gain, down sampling factor and filter from
+the capture header, outputs produced with a different configuration are counted as mismatches.
+After the last code DRL stays high, so the driver reports _ADC7_TIMEOUT when a timeout is set.
+
+*/
+/* -------------------------------------------------------------------------- */
+
+#include "stdint.h"
+#include "__adc7_capture.h"
+
+#ifndef _ADC7_REPLAY_H_
+#define _ADC7_REPLAY_H_
+
+/** @defgroup ADC7_REPLAY_VAR Variables */                    /** @{ */
+
+/** Replay Mode */
+#define _ADC7REPLAY_FAST                0
+#define _ADC7REPLAY_RECORDED            1
+
+                                                                       /** @} */
+/** @defgroup ADC7_REPLAY_TYPES Types */                      /** @{ */
+
+typedef struct
+{
+    uint64_t    delivered;               /**< Codes handed to the simulated device */
+    uint64_t    late;                    /**< Recorded mode, outputs ready after their recorded time */
+    uint64_t    mismatches;              /**< Outputs produced with a configuration other than the recorded one */
+
+}T_adc7replay_stats;
+
+                                                                       /** @} */
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/** @defgroup ADC7_REPLAY_FUNC Replay Functions */            /** @{ */
+
+/**
+ * @brief Replay Open function
+ *
+ * @param[in] slot  mikroBUS slot (0 - _ADC7SIM_SLOTS-1)
+ * @param[in] path  Capture file
+ * @param[in] mode  _ADC7REPLAY_FAST or _ADC7REPLAY_RECORDED
+ * @returns _ADC7CAP_OK, _ADC7CAP_ERR_IO, _ADC7CAP_ERR_FORMAT or _ADC7CAP_ERR_PARAM
+ *
+ * Maps the capture and installs it as output source of the slot, replay starts from the first code.
+ * @note
+ * adc7sim_init removes output sources, open the replay after it.
+ */
+uint8_t adc7replay_open( uint8_t slot, const char *path, uint8_t mode );
+
+/**
+ * @brief Replay Close function
+ *
+ * @param[in] slot  mikroBUS slot (0 - _ADC7SIM_SLOTS-1)
+ *
+ * Restores the modelled output and unmaps the capture.
+ */
+void adc7replay_close( uint8_t slot );
+
+/**
+ * @brief Capture Get function
+ *
+ * @param[in] slot  mikroBUS slot (0 - _ADC7SIM_SLOTS-1)
+ * @returns Mapped capture, header holds the configuration to set
+ */
+const T_adc7cap_reader* adc7replay_capture( uint8_t slot );
+
+/**
+ * @brief Replay Seek function
+ *
+ * @param[in] slot  mikroBUS slot (0 - _ADC7SIM_SLOTS-1)
+ * @param[in] sample  Next code to deliver, e.g. from adc7cap_findTime
+ *
+ * Recorded mode timing restarts from this code.
+ */
+void adc7replay_seek( uint8_t slot, uint64_t sample );
+
+/**
+ * @brief Replay Done function
+ *
+ * @param[in] slot  mikroBUS slot (0 - _ADC7SIM_SLOTS-1)
+ * @returns 1 - all codes were delivered, 0 - replay in progress
+ */
+uint8_t adc7replay_done( uint8_t slot );
+
+/**
+ * @brief Statistics Get function
+ *
+ * @param[in] slot  mikroBUS slot (0 - _ADC7SIM_SLOTS-1)
+ * @param[out] stats  Memory where replay counters be stored
+ */
+void adc7replay_getStats( uint8_t slot, T_adc7replay_stats *stats );
+
+                                                                       /** @} */
+#ifdef __cplusplus
+} // extern "C"
+#endif
+#endif
+                                                                       /** @} */
+/* -------------------------------------------------------------------------- */
+/*
+  __adc7_replay.h
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+3. All advertising materials mentioning features or use of this software
+   must display the following acknowledgement:
+   This product includes software developed by the MikroElektonika.
+
+4. Neither the name of the MikroElektonika nor the
+   names of its contributors may be used to endorse or promote products
+   derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY MIKROELEKTRONIKA ''AS IS'' AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL MIKROELEKTRONIKA BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------------- */
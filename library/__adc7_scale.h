@@ -0,0 +1,184 @@
+/*
+    __adc7_scale.h
+
+-----------------------------------------------------------------------------
+
+  This file is part of mikroSDK.
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+----------------------------------------------------------------------------- */
+
+/**
+@file   __adc7_scale.h
+@brief    ADC_7 Scaling Constants and Arithmetic
+*/
+/**
+@defgroup   ADC7_SCALE
+@brief      Conversion constants and arithmetic shared by the C driver, the C++ driver and host tools
+@{
+
+Tables are given as initializers, every user defines its own array, so results scaled on
+the host from raw codes match the ones computed by the driver on the device. Frame decoding
+and scaling are static functions for the same reason, every user compiles its own copy.
+
+Frame pointers are not const qualified, const data is placed in ROM by the mikroC compilers.
+
+*/
+/* -------------------------------------------------------------------------- */
+
+#ifndef _ADC7_SCALE_H_
+#define _ADC7_SCALE_H_
+
+#include "stdint.h"
+
+#if defined( __cplusplus ) || defined( __GNUC__ )
+#define _ADC7_INLINE static inline
+#else
+#define _ADC7_INLINE static
+#endif
+
+/** Reference voltage in mV */
+#define _ADC7_VREF                  4076
+
+/**
+ * Per gain configuration (disabled, expansion, compression, both) constants,
+ * rows of { voltRef [mV], valueLSB, scaleUv, scaleNv }.
+ * scaleUv = VREF[uV] * 2^32 / valueLSB, scaleNv = VREF[nV] * 2^32 / valueLSB
+ */
+#define _ADC7_GAIN_CFG_INIT \
+{ \
+    { _ADC7_VREF,              2147483647, 8152000,  8152000004  }, \
+    { _ADC7_VREF,              1073741823, 16304000, 16304000015 }, \
+    { (float)_ADC7_VREF * 0.8, 2147483647, 6521600,  6521600003  }, \
+    { (float)_ADC7_VREF * 0.8, 1073741823, 13043200, 13043200012 } \
+}
+
+/** MCK pulses per result, indexed by down sampling factor - 2 */
+#define _ADC7_NUM_SAMPL_INIT \
+{ \
+    4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384 \
+}
+
+/** Raw code from the first 4 bytes of a frame, MSB first */
+_ADC7_INLINE int32_t _adc7_frameCode( uint8_t *frame )
+{
+    int32_t voltData;
+
+    voltData = frame[ 0 ];
+    voltData <<= 8;
+    voltData |= frame[ 1 ];
+    voltData <<= 8;
+    voltData |= frame[ 2 ];
+    voltData <<= 8;
+    voltData |= frame[ 3 ];
+
+    return voltData;
+}
+
+/**
+ * Configuration from the trailer (bytes 4 and 5) of an extended frame,
+ * returns 1 and leaves the outputs unchanged if the trailer is not valid
+ */
+_ADC7_INLINE uint8_t _adc7_frameTrailer( uint8_t *frame, uint8_t *gainConfig, uint8_t *downSampFactor,
+                                         uint8_t *filterType )
+{
+    uint8_t tempDf;
+    uint8_t tempFilt;
+
+    tempDf = frame[ 4 ] & 0x0F;
+    tempFilt = frame[ 5 ] >> 4;
+
+    if (((frame[ 4 ] & 0xC0) != 0x80) || (frame[ 5 ] & 0x0F))
+    {
+        return 1;
+    }
+    if ((tempDf < 2) || (tempDf > 14) || (tempFilt < 1) || (tempFilt > 7))
+    {
+        return 1;
+    }
+
+    *gainConfig = (frame[ 4 ] >> 4) & 0x03;
+    *downSampFactor = tempDf;
+    *filterType = tempFilt;
+
+    return 0;
+}
+
+/**
+ * Code to uV with the scaleUv of a gain configuration, rounded to nearest,
+ * magnitudes are shifted so no signed right shift is needed
+ */
+_ADC7_INLINE int32_t _adc7_scaleUv( int32_t code, uint32_t scaleUv )
+{
+    int64_t temp;
+
+    temp = (int64_t)code * scaleUv;
+
+    if (temp < 0)
+    {
+        return -(int32_t)((uint64_t)(-temp + 0x80000000) >> 32);
+    }
+
+    return (int32_t)((uint64_t)(temp + 0x80000000) >> 32);
+}
+
+/**
+ * Code to nV with the scaleNv of a gain configuration, rounded to nearest,
+ * scaleNv exceeds 32 bits so integer and fractional nV per LSB are multiplied separately
+ */
+_ADC7_INLINE int64_t _adc7_scaleNv( int32_t code, uint64_t scaleNv )
+{
+    uint64_t magnitude;
+    uint64_t temp;
+
+    magnitude = (code < 0) ? (uint64_t)(-(int64_t)code) : (uint64_t)code;
+
+    temp = magnitude * (scaleNv >> 32);
+    temp += (magnitude * (scaleNv & 0xFFFFFFFF) + 0x80000000) >> 32;
+
+    return (code < 0) ? -(int64_t)temp : (int64_t)temp;
+}
+
+#endif
+                                                                       /** @} */
+/* -------------------------------------------------------------------------- */
+/*
+  __adc7_scale.h
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+3. All advertising materials mentioning features or use of this software
+   must display the following acknowledgement:
+   This product includes software developed by the MikroElektonika.
+
+4. Neither the name of the MikroElektonika nor the
+   names of its contributors may be used to endorse or promote products
+   derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY MIKROELEKTRONIKA ''AS IS'' AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL MIKROELEKTRONIKA BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------------- */
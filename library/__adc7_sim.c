@@ -0,0 +1,864 @@
+/*
+    __adc7_sim.c
+
+-----------------------------------------------------------------------------
+
+  This file is part of mikroSDK.
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+----------------------------------------------------------------------------- */
+
+#include "__adc7_sim.h"
+
+/* ------------------------------------------------------------------- MACROS */
+
+#define VREF                4076
+#define GAIN_COMPR_SCALE    0.8
+
+#define FULL_SCALE          2147483647
+#define FULL_SCALE_EXPAN    1073741823
+#define NYQ_FULL_SCALE      8388607
+
+#define OUT_FRAME_LEN       6
+
+/* ---------------------------------------------------------------- VARIABLES */
+
+typedef struct
+{
+    uint8_t     mck;
+    uint8_t     pre;
+    uint8_t     cs;
+    uint8_t     busy;
+    uint8_t     drl;
+    uint8_t     drlPending;              /**< Output latched, DRL falls at drlAt */
+    uint8_t     faults;
+    uint64_t    drlAt;
+    uint64_t    busyEnd;
+
+    uint16_t    trainLeft;
+    uint64_t    trainNext;
+    uint64_t    trainPeriod;
+
+    uint8_t     *dmaBuf;
+    uint16_t    dmaLeft;
+    uint64_t    dmaNext;
+
+    uint32_t    rateCount;
+    uint64_t    rateFirst;
+    uint64_t    rateLast;
+
+    uint8_t     gain;
+    uint8_t     downSampFactor;
+    uint8_t     filterType;
+
+    uint16_t    convCount;
+    double      convSum;
+    int32_t     outCode;
+    int32_t     nyqCode;
+
+    uint8_t     outFrame[ OUT_FRAME_LEN ];
+    uint8_t     outIdx;
+    uint8_t     inFrame[ 2 ];
+    uint8_t     inIdx;
+
+    double              input;
+    T_adc7sim_inputFp   inputFn;
+    T_adc7sim_outputFp  outputFn;
+    T_adc7sim_irqFp     busyIrq;
+    T_adc7sim_irqFp     drlIrq;
+    T_adc7sim_irqFp     dmaIrq;
+
+    T_adc7sim_stats     stats;
+
+}T_adc7sim_dev;
+
+static T_adc7sim_dev    _dev[ _ADC7SIM_SLOTS ];
+static uint64_t         _now;
+
+static T_adc7sim_timing _timing =
+{
+    _ADC7SIM_T_CONV_DEF,
+    _ADC7SIM_T_GPIO_DEF,
+    _ADC7SIM_T_SPI_BYTE_DEF,
+    _ADC7SIM_T_CALL_DEF
+};
+
+/* -------------------------------------------- PRIVATE FUNCTION DECLARATIONS */
+
+static void _advance( uint64_t ns );
+static uint8_t _nextEvent( uint64_t limit, uint8_t *pSlot, uint8_t *pEvent, uint64_t *pAt );
+static void _event( uint8_t slot, uint8_t event );
+static double _inputAt( uint8_t slot, uint64_t timeNs );
+static int32_t _toCode( T_adc7sim_dev *dev, double milliVolts );
+static int32_t _toNyqCode( T_adc7sim_dev *dev, double milliVolts );
+static void _sync( T_adc7sim_dev *dev );
+static uint8_t _latchOutput( T_adc7sim_dev *dev );
+static void _fillFrame( T_adc7sim_dev *dev );
+static void _frameEnd( T_adc7sim_dev *dev );
+static void _mckEdge( T_adc7sim_dev *dev, uint64_t timeNs );
+static void _convDone( uint8_t slot );
+
+static void _mckSet( uint8_t slot, uint8_t state );
+static void _preSet( uint8_t slot, uint8_t state );
+static void _csSet( uint8_t slot, uint8_t state );
+static uint8_t _busyGet( uint8_t slot );
+static uint8_t _drlGet( uint8_t slot );
+static uint8_t _spiByte( uint8_t slot, uint8_t input );
+static uint8_t _spiShift( T_adc7sim_dev *dev, uint8_t input );
+static void _dmaByte( uint8_t slot );
+
+/* --------------------------------------------- PRIVATE FUNCTION DEFINITIONS */
+
+/*
+ * Moves the virtual clock to each pending event in turn and handles it at its own time, so
+ * interrupt handlers see the clock of the edge that raised them and the pin accesses they
+ * make fall inside the window. Handlers may advance the clock themselves, the next event is
+ * looked up again after every one.
+ */
+static void _advance( uint64_t ns )
+{
+    uint64_t target = _now + ns;
+    uint64_t at;
+    uint8_t slot;
+    uint8_t event;
+
+    while (_nextEvent( target, &slot, &event, &at ))
+    {
+        if (at > _now)
+        {
+            _now = at;
+        }
+        _event( slot, event );
+    }
+
+    if (_now < target)
+    {
+        _now = target;
+    }
+}
+
+/*
+ * Finds the earliest conversion end, pulse train edge, DMA byte or deferred DRL fall of all
+ * slots that is due at or before limit. Returns 0 if there is none.
+ */
+static uint8_t _nextEvent( uint64_t limit, uint8_t *pSlot, uint8_t *pEvent, uint64_t *pAt )
+{
+    T_adc7sim_dev *dev;
+    uint64_t next = limit + 1;
+    uint8_t slot;
+
+    *pEvent = 0;
+
+    for (slot = 0; slot < _ADC7SIM_SLOTS; slot++)
+    {
+        dev = &_dev[ slot ];
+
+        if (dev->busy && (dev->busyEnd < next))
+        {
+            next = dev->busyEnd;
+            *pSlot = slot;
+            *pEvent = 1;
+        }
+        if (dev->trainLeft && (dev->trainNext < next))
+        {
+            next = dev->trainNext;
+            *pSlot = slot;
+            *pEvent = 2;
+        }
+        if (dev->dmaLeft && (dev->dmaNext < next))
+        {
+            next = dev->dmaNext;
+            *pSlot = slot;
+            *pEvent = 3;
+        }
+        if (dev->drlPending && (dev->drlAt < next))
+        {
+            next = dev->drlAt;
+            *pSlot = slot;
+            *pEvent = 4;
+        }
+    }
+
+    *pAt = next;
+
+    return *pEvent;
+}
+
+static void _event( uint8_t slot, uint8_t event )
+{
+    T_adc7sim_dev *dev = &_dev[ slot ];
+
+    if (event == 1)
+    {
+        _convDone( slot );
+    }
+    else if (event == 2)
+    {
+        dev->trainLeft--;
+        if (!(dev->faults & _ADC7SIM_FAULT_MCK_OPEN))
+        {
+            _mckEdge( dev, dev->trainNext );
+        }
+        dev->trainNext += dev->trainPeriod;
+    }
+    else if (event == 3)
+    {
+        _dmaByte( slot );
+    }
+    else if (event == 4)
+    {
+        dev->drlPending = 0;
+        dev->drl = 0;
+        if (dev->drlIrq && !(dev->faults & _ADC7SIM_FAULT_DRL_HIGH))
+        {
+            dev->drlIrq();
+        }
+    }
+}
+
+static void _convDone( uint8_t slot )
+{
+    T_adc7sim_dev *dev = &_dev[ slot ];
+    double input;
+    uint8_t drlNow;
+
+    dev->busy = 0;
+    dev->stats.conversions++;
+    input = _inputAt( slot, dev->busyEnd );
+    dev->nyqCode = _toNyqCode( dev, input );
+    dev->convSum += _toCode( dev, input );
+    dev->convCount++;
+
+    if (dev->convCount >= ((uint16_t)1 << dev->downSampFactor))
+    {
+        drlNow = _latchOutput( dev );
+
+        if (dev->busyIrq && !(dev->faults & _ADC7SIM_FAULT_BUSY_HIGH))
+        {
+            dev->busyIrq();
+        }
+        if (drlNow && dev->drlIrq && !(dev->faults & _ADC7SIM_FAULT_DRL_HIGH))
+        {
+            dev->drlIrq();
+        }
+    }
+    else if (dev->busyIrq && !(dev->faults & _ADC7SIM_FAULT_BUSY_HIGH))
+    {
+        dev->busyIrq();
+    }
+}
+
+static void _mckEdge( T_adc7sim_dev *dev, uint64_t timeNs )
+{
+    dev->stats.mckPulses++;
+
+    if (dev->busy)
+    {
+        dev->stats.mckIgnored++;
+        return;
+    }
+
+    dev->busy = 1;
+    dev->busyEnd = timeNs + _timing.tConv;
+
+    if (!dev->rateCount)
+    {
+        dev->rateFirst = timeNs;
+    }
+    dev->rateLast = timeNs;
+    dev->rateCount++;
+}
+
+static double _inputAt( uint8_t slot, uint64_t timeNs )
+{
+    if (_dev[ slot ].inputFn)
+    {
+        return _dev[ slot ].inputFn( slot, timeNs );
+    }
+
+    return _dev[ slot ].input;
+}
+
+static int32_t _toCode( T_adc7sim_dev *dev, double milliVolts )
+{
+    double fullScale;
+    double code;
+
+    fullScale = (dev->gain & 0x01) ? FULL_SCALE_EXPAN : FULL_SCALE;
+    code = milliVolts / VREF;
+
+    if (dev->gain & 0x02)
+    {
+        code /= GAIN_COMPR_SCALE;
+    }
+
+    code *= fullScale;
+
+    if (code > 2147483647.0)
+    {
+        return 2147483647;
+    }
+    if (code < -2147483648.0)
+    {
+        return (int32_t)0x80000000;
+    }
+
+    return (int32_t)code;
+}
+
+/* Nyquist output bypasses the digital filter and digital gain expansion */
+static int32_t _toNyqCode( T_adc7sim_dev *dev, double milliVolts )
+{
+    double code;
+
+    code = milliVolts / VREF;
+
+    if (dev->gain & 0x02)
+    {
+        code /= GAIN_COMPR_SCALE;
+    }
+
+    code *= NYQ_FULL_SCALE;
+
+    if (code > NYQ_FULL_SCALE)
+    {
+        return NYQ_FULL_SCALE;
+    }
+    if (code < -NYQ_FULL_SCALE - 1)
+    {
+        return -NYQ_FULL_SCALE - 1;
+    }
+
+    return (int32_t)code;
+}
+
+static void _sync( T_adc7sim_dev *dev )
+{
+    dev->convCount = 0;
+    dev->convSum = 0;
+    dev->drl = 1;
+    dev->drlPending = 0;
+}
+
+/*
+ * All filter types are modelled as a plain average over the down sampling window,
+ * which matches the averaging filter and the DC response of the others.
+ * Returns 1 if DRL fell, 0 if the output source deferred it or had no output.
+ */
+static uint8_t _latchOutput( T_adc7sim_dev *dev )
+{
+    uint64_t drlNs = 0;
+    double avg;
+
+    avg = dev->convSum / dev->convCount;
+    dev->outCode = (avg >= 0) ? (int32_t)(avg + 0.5) : (int32_t)(avg - 0.5);
+    dev->convCount = 0;
+    dev->convSum = 0;
+
+    if (dev->outputFn && dev->outputFn( dev - _dev, &dev->outCode, &drlNs ))
+    {
+        return 0;
+    }
+
+    _fillFrame( dev );
+    dev->stats.outputs++;
+
+    if (drlNs > _now)
+    {
+        dev->drlAt = drlNs;
+        dev->drlPending = 1;
+        return 0;
+    }
+
+    dev->drl = 0;
+
+    return 1;
+}
+
+static void _fillFrame( T_adc7sim_dev *dev )
+{
+    dev->outFrame[ 0 ] = (uint8_t)(dev->outCode >> 24);
+    dev->outFrame[ 1 ] = (uint8_t)(dev->outCode >> 16);
+    dev->outFrame[ 2 ] = (uint8_t)(dev->outCode >> 8);
+    dev->outFrame[ 3 ] = (uint8_t)dev->outCode;
+    dev->outFrame[ 4 ] = 0x80 | (dev->gain << 4) | dev->downSampFactor;
+    dev->outFrame[ 5 ] = dev->filterType << 4;
+}
+
+/*
+ * A frame starting with a valid configuration word (1 0 DGC DGE DF[3:0] FILT[3:0]) programs
+ * the digital filter and synchronizes it. Zeros on SDI keep the active configuration.
+ */
+static void _frameEnd( T_adc7sim_dev *dev )
+{
+    uint8_t downSampFactor;
+    uint8_t filterType;
+
+    if ((dev->inIdx >= 2) && ((dev->inFrame[ 0 ] & 0xC0) == 0x80))
+    {
+        downSampFactor = dev->inFrame[ 0 ] & 0x0F;
+        filterType = dev->inFrame[ 1 ] >> 4;
+
+        if ((downSampFactor >= 2) && (downSampFactor <= 14) && (filterType >= 1) && (filterType <= 7))
+        {
+            dev->gain = (dev->inFrame[ 0 ] >> 4) & 0x03;
+            dev->downSampFactor = downSampFactor;
+            dev->filterType = filterType;
+            dev->stats.configWrites++;
+            _sync( dev );
+        }
+    }
+
+    dev->inIdx = 0;
+    dev->outIdx = 0;
+}
+
+static void _mckSet( uint8_t slot, uint8_t state )
+{
+    T_adc7sim_dev *dev = &_dev[ slot ];
+
+    dev->stats.gpioWrites++;
+    dev->stats.gpioTime += _timing.tGpio;
+    _advance( _timing.tGpio );
+
+    if (state && !dev->mck && !(dev->faults & _ADC7SIM_FAULT_MCK_OPEN))
+    {
+        _mckEdge( dev, _now );
+    }
+
+    dev->mck = state ? 1 : 0;
+}
+
+static void _preSet( uint8_t slot, uint8_t state )
+{
+    T_adc7sim_dev *dev = &_dev[ slot ];
+
+    dev->stats.gpioWrites++;
+    dev->stats.gpioTime += _timing.tGpio;
+    _advance( _timing.tGpio );
+
+    if (state && !dev->pre)
+    {
+        dev->stats.prePulses++;
+        dev->gain = 0;
+        dev->downSampFactor = 2;
+        dev->filterType = 1;
+        _sync( dev );
+    }
+
+    dev->pre = state ? 1 : 0;
+}
+
+static void _csSet( uint8_t slot, uint8_t state )
+{
+    T_adc7sim_dev *dev = &_dev[ slot ];
+
+    dev->stats.gpioWrites++;
+    dev->stats.gpioTime += _timing.tGpio;
+    _advance( _timing.tGpio );
+
+    if (state && !dev->cs)
+    {
+        _frameEnd( dev );
+    }
+    else if (!state && dev->cs)
+    {
+        dev->inIdx = 0;
+        dev->outIdx = 0;
+    }
+
+    dev->cs = state ? 1 : 0;
+}
+
+static uint8_t _busyGet( uint8_t slot )
+{
+    _dev[ slot ].stats.gpioReads++;
+    _dev[ slot ].stats.gpioTime += _timing.tGpio;
+    _advance( _timing.tGpio );
+
+    if (_dev[ slot ].faults & _ADC7SIM_FAULT_BUSY_HIGH)
+    {
+        return 1;
+    }
+
+    return _dev[ slot ].busy;
+}
+
+static uint8_t _drlGet( uint8_t slot )
+{
+    _dev[ slot ].stats.gpioReads++;
+    _dev[ slot ].stats.gpioTime += _timing.tGpio;
+    _advance( _timing.tGpio );
+
+    if (_dev[ slot ].faults & _ADC7SIM_FAULT_DRL_HIGH)
+    {
+        return 1;
+    }
+
+    return _dev[ slot ].drl;
+}
+
+static uint8_t _spiByte( uint8_t slot, uint8_t input )
+{
+    T_adc7sim_dev *dev = &_dev[ slot ];
+
+    dev->stats.spiBytes++;
+    dev->stats.spiTime += _timing.tSpiByte;
+    _advance( _timing.tSpiByte );
+
+    return _spiShift( dev, input );
+}
+
+static uint8_t _spiShift( T_adc7sim_dev *dev, uint8_t input )
+{
+    uint8_t output = 0;
+
+    if (dev->cs)
+    {
+        return 0xFF;
+    }
+
+    if (dev->inIdx < sizeof( dev->inFrame ))
+    {
+        dev->inFrame[ dev->inIdx++ ] = input;
+    }
+    if (dev->outIdx < OUT_FRAME_LEN)
+    {
+        output = dev->outFrame[ dev->outIdx++ ];
+    }
+
+    // reading the output clears DRL
+    dev->drl = 1;
+
+    return output;
+}
+
+/* DMA bytes are clocked in the background, they cost no CPU time */
+static void _dmaByte( uint8_t slot )
+{
+    T_adc7sim_dev *dev = &_dev[ slot ];
+
+    dev->stats.dmaBytes++;
+    *( dev->dmaBuf++ ) = _spiShift( dev, 0x00 );
+    dev->dmaNext += _timing.tSpiByte;
+
+    if (!--dev->dmaLeft && dev->dmaIrq)
+    {
+        dev->dmaIrq();
+    }
+}
+
+/* mikroBUS slot bindings */
+
+/*
+ * GPIO entries of the mikroBUS objects are reached through hal_gpioMap pointers, each call
+ * is charged the indirect call overhead on top of the pin access. adc7sim_mckSet and the
+ * other direct functions stand for accessors bound at compile time and are not.
+ */
+static void _call( uint8_t slot )
+{
+    _dev[ slot ].stats.gpioCalls++;
+    _dev[ slot ].stats.gpioTime += _timing.tCall;
+    _advance( _timing.tCall );
+}
+
+#define SLOT_FUNCTIONS(n) \
+static void _mck##n( uint8_t state ) { _call( n ); _mckSet( n, state ); } \
+static void _pre##n( uint8_t state ) { _call( n ); _preSet( n, state ); } \
+static void _cs##n( uint8_t state ) { _call( n ); _csSet( n, state ); } \
+static uint8_t _busy##n() { _call( n ); return _busyGet( n ); } \
+static uint8_t _drl##n() { _call( n ); return _drlGet( n ); } \
+static void _spiWrite##n( unsigned int input ) { _spiByte( n, (uint8_t)input ); } \
+static unsigned int _spiRead##n( unsigned int input ) { return _spiByte( n, (uint8_t)input ); }
+
+SLOT_FUNCTIONS( 0 )
+SLOT_FUNCTIONS( 1 )
+
+static void _pinNoSet( uint8_t state ) { (void)state; }
+static uint8_t _pinNoGet() { return 0; }
+
+#define SLOT_GPIO(n) \
+{ \
+    { _pinNoSet, _pre##n, _cs##n, _pinNoSet, _pinNoSet, _pinNoSet, \
+      _mck##n, _pinNoSet, _pinNoSet, _pinNoSet, _pinNoSet, _pinNoSet }, \
+    { _drl##n, _pinNoGet, _pinNoGet, _pinNoGet, _pinNoGet, _pinNoGet, \
+      _pinNoGet, _busy##n, _pinNoGet, _pinNoGet, _pinNoGet, _pinNoGet } \
+}
+
+const T_adc7sim_gpioObj _MIKROBUS1_GPIO = SLOT_GPIO( 0 );
+const T_adc7sim_spiObj  _MIKROBUS1_SPI  = { _spiWrite0, _spiRead0 };
+const T_adc7sim_gpioObj _MIKROBUS2_GPIO = SLOT_GPIO( 1 );
+const T_adc7sim_spiObj  _MIKROBUS2_SPI  = { _spiWrite1, _spiRead1 };
+
+/* --------------------------------------------------------- PUBLIC FUNCTIONS */
+
+void adc7sim_init( void )
+{
+    uint8_t slot;
+    T_adc7sim_dev *dev;
+
+    _now = 0;
+
+    for (slot = 0; slot < _ADC7SIM_SLOTS; slot++)
+    {
+        dev = &_dev[ slot ];
+
+        dev->mck = 0;
+        dev->pre = 0;
+        dev->cs = 1;
+        dev->busy = 0;
+        dev->faults = _ADC7SIM_FAULT_NONE;
+        dev->busyEnd = 0;
+        dev->trainLeft = 0;
+        dev->dmaLeft = 0;
+        dev->rateCount = 0;
+        dev->gain = 0;
+        dev->downSampFactor = 2;
+        dev->filterType = 1;
+        dev->outCode = 0;
+        dev->outIdx = 0;
+        dev->inIdx = 0;
+        dev->input = 0;
+        dev->inputFn = 0;
+        dev->outputFn = 0;
+        dev->busyIrq = 0;
+        dev->drlIrq = 0;
+        dev->dmaIrq = 0;
+        _sync( dev );
+        _fillFrame( dev );
+        dev->stats = (T_adc7sim_stats){ 0 };
+    }
+}
+
+void adc7sim_setTiming( const T_adc7sim_timing *timing )
+{
+    _timing = *timing;
+}
+
+void adc7sim_setInput( uint8_t slot, double milliVolts )
+{
+    _dev[ slot ].input = milliVolts;
+}
+
+void adc7sim_setInputFn( uint8_t slot, T_adc7sim_inputFp inputFn )
+{
+    _dev[ slot ].inputFn = inputFn;
+}
+
+void adc7sim_setOutputFn( uint8_t slot, T_adc7sim_outputFp outputFn )
+{
+    _dev[ slot ].outputFn = outputFn;
+}
+
+void adc7sim_setIrq( uint8_t slot, T_adc7sim_irqFp busyIrq, T_adc7sim_irqFp drlIrq )
+{
+    _dev[ slot ].busyIrq = busyIrq;
+    _dev[ slot ].drlIrq = drlIrq;
+}
+
+void adc7sim_pulseTrain( uint8_t slot, uint16_t count, uint32_t rate )
+{
+    T_adc7sim_dev *dev = &_dev[ slot ];
+
+    dev->trainLeft = count;
+    dev->trainPeriod = 1000000000ull / rate;
+    dev->trainNext = _now;
+    _advance( 0 );
+}
+
+void adc7sim_pulseTrain1( uint16_t count, uint32_t rate )
+{
+    adc7sim_pulseTrain( 0, count, rate );
+}
+
+void adc7sim_pulseTrain2( uint16_t count, uint32_t rate )
+{
+    adc7sim_pulseTrain( 1, count, rate );
+}
+
+void adc7sim_setDmaIrq( uint8_t slot, T_adc7sim_irqFp dmaIrq )
+{
+    _dev[ slot ].dmaIrq = dmaIrq;
+}
+
+void adc7sim_dmaRead( uint8_t slot, uint8_t *pOut, uint16_t nBytes )
+{
+    T_adc7sim_dev *dev = &_dev[ slot ];
+
+    dev->dmaBuf = pOut;
+    dev->dmaLeft = nBytes;
+    dev->dmaNext = _now + _timing.tSpiByte;
+}
+
+void adc7sim_dmaRead1( uint8_t *pOut, uint16_t nBytes )
+{
+    adc7sim_dmaRead( 0, pOut, nBytes );
+}
+
+void adc7sim_dmaRead2( uint8_t *pOut, uint16_t nBytes )
+{
+    adc7sim_dmaRead( 1, pOut, nBytes );
+}
+
+void adc7sim_nyquistRead( uint8_t slot, uint8_t *pOut, uint16_t nBytes )
+{
+    T_adc7sim_dev *dev = &_dev[ slot ];
+    uint8_t idx;
+
+    for (idx = 0; nBytes--; idx++)
+    {
+        dev->stats.nyqBytes++;
+        dev->stats.spiTime += _timing.tSpiByte;
+        _advance( _timing.tSpiByte );
+
+        *( pOut++ ) = (idx < 3) ? (uint8_t)(dev->nyqCode >> (16 - 8 * idx)) : 0x00;
+    }
+}
+
+void adc7sim_nyquistRead1( uint8_t *pOut, uint16_t nBytes )
+{
+    adc7sim_nyquistRead( 0, pOut, nBytes );
+}
+
+void adc7sim_nyquistRead2( uint8_t *pOut, uint16_t nBytes )
+{
+    adc7sim_nyquistRead( 1, pOut, nBytes );
+}
+
+void adc7sim_mckSet( uint8_t slot, uint8_t state )
+{
+    _mckSet( slot, state );
+}
+
+void adc7sim_preSet( uint8_t slot, uint8_t state )
+{
+    _preSet( slot, state );
+}
+
+void adc7sim_csSet( uint8_t slot, uint8_t state )
+{
+    _csSet( slot, state );
+}
+
+uint8_t adc7sim_busyGet( uint8_t slot )
+{
+    return _busyGet( slot );
+}
+
+uint8_t adc7sim_drlGet( uint8_t slot )
+{
+    return _drlGet( slot );
+}
+
+uint8_t adc7sim_spiTransfer( uint8_t slot, uint8_t input )
+{
+    return _spiByte( slot, input );
+}
+
+void adc7sim_setFault( uint8_t slot, uint8_t faults )
+{
+    _dev[ slot ].faults = faults;
+}
+
+uint32_t adc7sim_getMckRate( uint8_t slot )
+{
+    T_adc7sim_dev *dev = &_dev[ slot ];
+    uint32_t rate = 0;
+
+    if ((dev->rateCount > 1) && (dev->rateLast > dev->rateFirst))
+    {
+        rate = (uint32_t)((dev->rateCount - 1) * 1000000000ull / (dev->rateLast - dev->rateFirst));
+    }
+
+    dev->rateCount = 0;
+
+    return rate;
+}
+
+uint64_t adc7sim_now( void )
+{
+    return _now;
+}
+
+uint32_t adc7sim_tick( void )
+{
+    return (uint32_t)_now;
+}
+
+void adc7sim_delayNs( uint32_t ns )
+{
+    _advance( ns );
+}
+
+void adc7sim_cpuAccess( void )
+{
+    _advance( _timing.tGpio );
+}
+
+void adc7sim_getStats( uint8_t slot, T_adc7sim_stats *stats )
+{
+    *stats = _dev[ slot ].stats;
+}
+
+void adc7sim_getConfig( uint8_t slot, uint8_t *cfg )
+{
+    cfg[ 0 ] = 0x80 | (_dev[ slot ].gain << 4) | _dev[ slot ].downSampFactor;
+    cfg[ 1 ] = _dev[ slot ].filterType << 4;
+}
+
+int32_t adc7sim_codeOf( uint8_t slot, double milliVolts )
+{
+    return _toCode( &_dev[ slot ], milliVolts );
+}
+
+void Delay_1us( void )
+{
+    _advance( 1000 );
+}
+
+void Delay_ms( uint32_t ms )
+{
+    _advance( (uint64_t)ms * 1000000 );
+}
+
+/* -------------------------------------------------------------------------- */
+/*
+  __adc7_sim.c
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+3. All advertising materials mentioning features or use of this software
+   must display the following acknowledgement:
+   This product includes software developed by the MikroElektonika.
+
+4. Neither the name of the MikroElektonika nor the
+   names of its contributors may be used to endorse or promote products
+   derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY MIKROELEKTRONIKA ''AS IS'' AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL MIKROELEKTRONIKA BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------------- */
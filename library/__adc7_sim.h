@@ -0,0 +1,399 @@
+/*
+    __adc7_sim.h
+
+-----------------------------------------------------------------------------
+
+  This file is part of mikroSDK.
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+----------------------------------------------------------------------------- */
+
+/**
+@file   __adc7_sim.h
+@brief    ADC_7 Simulator
+*/
+/**
+@defgroup   ADC7_SIM
+@brief      LTC2500 software model for the Linux HAL
+@{
+
+| Global Library Prefix | **ADC7SIM**        |
+|:---------------------:|:------------------:|
+| Version               | **1.0.0**          |
+| Date                  | **Oct 2026.**      |
+| Developer             | **MikroE FW Team** |
+
+The simulator replaces the mikroBUS objects (_MIKROBUS1_GPIO, _MIKROBUS1_SPI ...) on Linux,
+so the driver can be built natively and exercised without a board.
+
+| mikroBUS pin | LTC2500 signal | Direction |
+|:------------:|:--------------:|:---------:|
+| INT          | BUSY           | input     |
+| AN           | DRL            | input     |
+| PWM          | MCK            | output    |
+| RST          | PRE            | output    |
+| CS           | RDL / CS       | output    |
+
+The model runs on a virtual clock (ns). Every GPIO access, SPI byte and delay
+advances the clock by the configured cost, so timings reported by the simulator
+approximate the target, not the host.
+
+*/
+/* -------------------------------------------------------------------------- */
+
+#include "stdint.h"
+
+#ifndef _ADC7_SIM_H_
+#define _ADC7_SIM_H_
+
+/** @defgroup ADC7_SIM_VAR Variables */                       /** @{ */
+
+/** Number of simulated mikroBUS slots */
+#define _ADC7SIM_SLOTS                  2
+
+/**
+ * Default timing (ns). tGpio and tCall are assumed figures, not measurements : tCall stands for
+ * the load, indirect branch and return of a call through a function pointer, about 6 cycles at
+ * 150 MHz. Set the values measured on the target with adc7sim_setTiming.
+ */
+#define _ADC7SIM_T_CONV_DEF             660
+#define _ADC7SIM_T_GPIO_DEF             20
+#define _ADC7SIM_T_SPI_BYTE_DEF         800
+#define _ADC7SIM_T_CALL_DEF             40
+
+/** Injected faults */
+#define _ADC7SIM_FAULT_NONE             0x00
+#define _ADC7SIM_FAULT_BUSY_HIGH        0x01    /**< BUSY stuck high */
+#define _ADC7SIM_FAULT_DRL_HIGH         0x02    /**< DRL stuck high */
+#define _ADC7SIM_FAULT_MCK_OPEN         0x04    /**< MCK not connected, pulses do not reach the device */
+
+                                                                       /** @} */
+/** @defgroup ADC7_SIM_TYPES Types */                         /** @{ */
+
+typedef void     (*T_adc7sim_gpioSetFp)(uint8_t);
+typedef uint8_t  (*T_adc7sim_gpioGetFp)();
+typedef void     (*T_adc7sim_spiWriteFp)(unsigned int);
+typedef unsigned int (*T_adc7sim_spiReadFp)(unsigned int);
+
+/** Edge interrupt handler */
+typedef void     (*T_adc7sim_irqFp)(void);
+
+/** Input signal source, returns input voltage in mV at given virtual time */
+typedef double   (*T_adc7sim_inputFp)(uint8_t slot, uint64_t timeNs);
+
+/**
+ * Filter output source, replaces the modelled output code. Returns 0 with the code and the
+ * earliest virtual time DRL may fall, or 1 - no output (DRL stays high).
+ */
+typedef uint8_t  (*T_adc7sim_outputFp)(uint8_t slot, int32_t *code, uint64_t *drlNs);
+
+/** Same layout as T_hal_gpioObj */
+typedef struct
+{
+    T_adc7sim_gpioSetFp     gpioSet[ 12 ];
+    T_adc7sim_gpioGetFp     gpioGet[ 12 ];
+
+}T_adc7sim_gpioObj;
+
+/** Same layout as T_hal_spiObj of the Linux HAL */
+typedef struct
+{
+    T_adc7sim_spiWriteFp    spiWrite;
+    T_adc7sim_spiReadFp     spiRead;
+
+}T_adc7sim_spiObj;
+
+typedef struct
+{
+    uint32_t    tConv;                   /**< BUSY high time after MCK rising edge */
+    uint32_t    tGpio;                   /**< Cost of one GPIO access */
+    uint32_t    tSpiByte;                /**< Cost of one SPI byte */
+    uint32_t    tCall;                   /**< Extra cost (assumed) of a GPIO access through the mikroBUS object pointers */
+
+}T_adc7sim_timing;
+
+typedef struct
+{
+    uint32_t    mckPulses;
+    uint32_t    mckIgnored;              /**< MCK pulses received while BUSY was high */
+    uint32_t    conversions;
+    uint32_t    outputs;
+    uint32_t    configWrites;
+    uint32_t    prePulses;               /**< PRE rising edges (device resets) */
+    uint32_t    spiBytes;
+    uint32_t    dmaBytes;                /**< Bytes clocked by the simulated DMA */
+    uint32_t    nyqBytes;                /**< Bytes clocked from SDOB */
+    uint32_t    gpioReads;
+    uint32_t    gpioWrites;
+    uint32_t    gpioCalls;               /**< GPIO accesses dispatched through the mikroBUS object pointers */
+    uint64_t    gpioTime;                /**< Virtual time spent in GPIO accesses */
+    uint64_t    spiTime;                 /**< Virtual time spent in SPI transfers */
+
+}T_adc7sim_stats;
+
+                                                                       /** @} */
+/** @defgroup ADC7_SIM_OBJ mikroBUS Objects */                /** @{ */
+
+extern const T_adc7sim_gpioObj  _MIKROBUS1_GPIO;
+extern const T_adc7sim_spiObj   _MIKROBUS1_SPI;
+extern const T_adc7sim_gpioObj  _MIKROBUS2_GPIO;
+extern const T_adc7sim_spiObj   _MIKROBUS2_SPI;
+
+                                                                       /** @} */
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/** @defgroup ADC7_SIM_FUNC Simulator Functions */            /** @{ */
+
+/**
+ * @brief Simulator Initialization function
+ *
+ * Function resets the virtual clock, statistics and all simulated devices to power-on state
+ * (gain disabled, down sampling factor 4, sinc1 filter, 0 mV input).
+ */
+void adc7sim_init( void );
+
+/**
+ * @brief Timing Set function
+ *
+ * @param[in] timing  Conversion time and access costs in ns
+ */
+void adc7sim_setTiming( const T_adc7sim_timing *timing );
+
+/**
+ * @brief Input Set function
+ *
+ * @param[in] slot  mikroBUS slot (0 - _ADC7SIM_SLOTS-1)
+ * @param[in] milliVolts  Constant differential input voltage
+ */
+void adc7sim_setInput( uint8_t slot, double milliVolts );
+
+/**
+ * @brief Input Source Set function
+ *
+ * @param[in] slot  mikroBUS slot (0 - _ADC7SIM_SLOTS-1)
+ * @param[in] inputFn  Input signal source, 0 - use constant input
+ */
+void adc7sim_setInputFn( uint8_t slot, T_adc7sim_inputFp inputFn );
+
+/**
+ * @brief Output Source Set function
+ *
+ * @param[in] slot  mikroBUS slot (0 - _ADC7SIM_SLOTS-1)
+ * @param[in] outputFn  Filter output source, 0 - use modelled output
+ *
+ * Conversions, BUSY and MCK handling stay modelled, only the code of every filter output and
+ * its DRL time come from outputFn (see __adc7_replay.h). DRL falls at the end of the conversion
+ * cycle or at the returned time, whichever is later.
+ */
+void adc7sim_setOutputFn( uint8_t slot, T_adc7sim_outputFp outputFn );
+
+/**
+ * @brief Virtual Time function
+ *
+ * @returns Virtual time in ns since adc7sim_init
+ */
+uint64_t adc7sim_now( void );
+
+/**
+ * @brief Tick function
+ *
+ * @returns Virtual time in ns, truncated to 32 bits (T_adc7_tickFp source)
+ */
+uint32_t adc7sim_tick( void );
+
+/**
+ * @brief Delay function
+ *
+ * @param[in] ns  Virtual time to advance
+ */
+void adc7sim_delayNs( uint32_t ns );
+
+/**
+ * @brief CPU Access function
+ *
+ * Advances the virtual clock by one GPIO access time (tGpio), for HAL code which takes CPU time
+ * without touching a simulated pin (remapping the mikroBUS object pointers). Interrupts due in
+ * that time are taken, as they are during pin accesses.
+ */
+void adc7sim_cpuAccess( void );
+
+/**
+ * @brief Statistics Get function
+ *
+ * @param[in] slot  mikroBUS slot (0 - _ADC7SIM_SLOTS-1)
+ * @param[out] stats  Memory where statistics be stored
+ */
+void adc7sim_getStats( uint8_t slot, T_adc7sim_stats *stats );
+
+/**
+ * @brief Active Configuration Get function
+ *
+ * @param[in] slot  mikroBUS slot (0 - _ADC7SIM_SLOTS-1)
+ * @param[out] cfg  2 bytes, same layout as configuration word written by adc7_setConfig
+ */
+void adc7sim_getConfig( uint8_t slot, uint8_t *cfg );
+
+/**
+ * @brief Expected Code function
+ *
+ * @param[in] slot  mikroBUS slot (0 - _ADC7SIM_SLOTS-1)
+ * @param[in] milliVolts  Input voltage
+ *
+ * @returns 32-bit code the device outputs for a constant input under the active configuration
+ */
+int32_t adc7sim_codeOf( uint8_t slot, double milliVolts );
+
+/**
+ * @brief Interrupt Set function
+ *
+ * @param[in] slot  mikroBUS slot (0 - _ADC7SIM_SLOTS-1)
+ * @param[in] busyIrq  Called on BUSY (INT pin) falling edge, 0 - disabled
+ * @param[in] drlIrq  Called on DRL (AN pin) falling edge, 0 - disabled
+ *
+ * Handlers run in the context of the simulator call which advanced the virtual clock
+ * past the edge, the same way an interrupt preempts the code running on the target.
+ */
+void adc7sim_setIrq( uint8_t slot, T_adc7sim_irqFp busyIrq, T_adc7sim_irqFp drlIrq );
+
+/**
+ * @brief Pulse Train function
+ *
+ * @param[in] slot  mikroBUS slot (0 - _ADC7SIM_SLOTS-1)
+ * @param[in] count  Number of MCK pulses
+ * @param[in] rate  MCK rate in Hz
+ *
+ * Function models a timer/PWM output driving MCK. The train starts at the current virtual time
+ * and runs while the virtual clock advances, the function does not wait for it to finish.
+ */
+void adc7sim_pulseTrain( uint8_t slot, uint16_t count, uint32_t rate );
+
+/** T_adc7_pulseTrainFp generators for mikroBUS 1 and 2 */
+void adc7sim_pulseTrain1( uint16_t count, uint32_t rate );
+void adc7sim_pulseTrain2( uint16_t count, uint32_t rate );
+
+/**
+ * @brief DMA Interrupt Set function
+ *
+ * @param[in] slot  mikroBUS slot (0 - _ADC7SIM_SLOTS-1)
+ * @param[in] dmaIrq  Called when DMA read is finished, 0 - disabled
+ */
+void adc7sim_setDmaIrq( uint8_t slot, T_adc7sim_irqFp dmaIrq );
+
+/**
+ * @brief DMA Read function
+ *
+ * @param[in] slot  mikroBUS slot (0 - _ADC7SIM_SLOTS-1)
+ * @param[out] pOut  Memory where data bytes be stored
+ * @param[in] nBytes  Number of bytes to be read
+ *
+ * Function models a DMA channel clocking nBytes on SPI (0x00 on SDI) while the virtual clock advances.
+ * CS is controlled by the caller, completion is signaled through the DMA interrupt.
+ */
+void adc7sim_dmaRead( uint8_t slot, uint8_t *pOut, uint16_t nBytes );
+
+/** T_adc7_dmaReadFp channels for mikroBUS 1 and 2 */
+void adc7sim_dmaRead1( uint8_t *pOut, uint16_t nBytes );
+void adc7sim_dmaRead2( uint8_t *pOut, uint16_t nBytes );
+
+/**
+ * @brief Nyquist Read function
+ *
+ * @param[in] slot  mikroBUS slot (0 - _ADC7SIM_SLOTS-1)
+ * @param[out] pOut  Memory where data bytes be stored
+ * @param[in] nBytes  Number of bytes to be read
+ *
+ * Function models the second serial port (SDOB): 24-bit unfiltered result of the last
+ * conversion, MSB first, 0x00 after the third byte.
+ */
+void adc7sim_nyquistRead( uint8_t slot, uint8_t *pOut, uint16_t nBytes );
+
+/** T_adc7_nyqReadFp channels for mikroBUS 1 and 2 */
+void adc7sim_nyquistRead1( uint8_t *pOut, uint16_t nBytes );
+void adc7sim_nyquistRead2( uint8_t *pOut, uint16_t nBytes );
+
+/**
+ * @name Direct Pin Access
+ *
+ * Same as the mikroBUS object entries, for HAL policies which bind the pins at compile time.
+ * @param[in] slot  mikroBUS slot (0 - _ADC7SIM_SLOTS-1)
+ */
+void adc7sim_mckSet( uint8_t slot, uint8_t state );
+void adc7sim_preSet( uint8_t slot, uint8_t state );
+void adc7sim_csSet( uint8_t slot, uint8_t state );
+uint8_t adc7sim_busyGet( uint8_t slot );
+uint8_t adc7sim_drlGet( uint8_t slot );
+uint8_t adc7sim_spiTransfer( uint8_t slot, uint8_t input );
+
+/**
+ * @brief Fault Set function
+ *
+ * @param[in] slot  mikroBUS slot (0 - _ADC7SIM_SLOTS-1)
+ * @param[in] faults  _ADC7SIM_FAULT_* flags, _ADC7SIM_FAULT_NONE - clears all faults
+ *
+ * Stuck pins read as high and do not generate edge interrupts. Faults model the wiring,
+ * so they are not cleared by PRE.
+ */
+void adc7sim_setFault( uint8_t slot, uint8_t faults );
+
+/**
+ * @brief MCK Rate Get function
+ *
+ * @param[in] slot  mikroBUS slot (0 - _ADC7SIM_SLOTS-1)
+ *
+ * @returns Achieved conversion rate in Hz, measured over MCK pulses accepted since previous call
+ */
+uint32_t adc7sim_getMckRate( uint8_t slot );
+
+/** mikroC built-in replacements, advance the virtual clock */
+void Delay_1us( void );
+void Delay_ms( uint32_t ms );
+
+                                                                       /** @} */
+#ifdef __cplusplus
+} // extern "C"
+#endif
+#endif
+                                                                       /** @} */
+/* -------------------------------------------------------------------------- */
+/*
+  __adc7_sim.h
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+3. All advertising materials mentioning features or use of this software
+   must display the following acknowledgement:
+   This product includes software developed by the MikroElektonika.
+
+4. Neither the name of the MikroElektonika nor the
+   names of its contributors may be used to endorse or promote products
+   derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY MIKROELEKTRONIKA ''AS IS'' AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL MIKROELEKTRONIKA BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------------- */
@@ -0,0 +1,91 @@
+/*
+    __adc7_sim.hpp
+
+-----------------------------------------------------------------------------
+
+  This file is part of mikroSDK.
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+----------------------------------------------------------------------------- */
+
+/**
+@file   __adc7_sim.hpp
+@brief    ADC_7 Simulator HAL policy for the C++ driver
+*/
+/**
+@defgroup   ADC7SIM_CPP
+@brief      adc7::Adc7 HAL policy driving the LTC2500 simulator
+@{
+
+@code
+adc7::Adc7< adc7::SimHal< 0 > > adc;        // mikroBUS 1
+@endcode
+
+*/
+/* -------------------------------------------------------------------------- */
+
+#include "__adc7_sim.h"
+
+#ifndef _ADC7_SIM_HPP_
+#define _ADC7_SIM_HPP_
+
+namespace adc7
+{
+
+template< uint8_t Slot >
+struct SimHal
+{
+    static void mckSet( uint8_t state )            { adc7sim_mckSet( Slot, state ); }
+    static void preSet( uint8_t state )            { adc7sim_preSet( Slot, state ); }
+    static void csSet( uint8_t state )             { adc7sim_csSet( Slot, state ); }
+    static uint8_t busyGet()                       { return adc7sim_busyGet( Slot ); }
+    static uint8_t drlGet()                        { return adc7sim_drlGet( Slot ); }
+    static uint8_t spiTransfer( uint8_t input )    { return adc7sim_spiTransfer( Slot, input ); }
+    static void delayUs()                          { adc7sim_delayNs( 1000 ); }
+};
+
+} // namespace adc7
+
+#endif
+                                                                       /** @} */
+/* -------------------------------------------------------------------------- */
+/*
+  __adc7_sim.hpp
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+3. All advertising materials mentioning features or use of this software
+   must display the following acknowledgement:
+   This product includes software developed by the MikroElektonika.
+
+4. Neither the name of the MikroElektonika nor the
+   names of its contributors may be used to endorse or promote products
+   derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY MIKROELEKTRONIKA ''AS IS'' AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL MIKROELEKTRONIKA BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------------- */
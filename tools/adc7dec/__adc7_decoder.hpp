@@ -0,0 +1,393 @@
+/*
+    __adc7_decoder.hpp
+
+-----------------------------------------------------------------------------
+
+  This file is part of mikroSDK.
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+----------------------------------------------------------------------------- */
+
+/**
+@file   __adc7_decoder.hpp
+@brief    ADC_7 Telemetry Stream Decoder
+*/
+/**
+@defgroup   ADC7_DECODER
+@brief      Host side decoder of the adc7_tlmFrame byte stream
+@{
+
+Splits the stream on 0x00 delimiters, COBS decodes and CRC checks every frame and passes it
+to a sink. Frames are decoded straight from the input buffer, only a frame split between
+two feed calls is copied. Sequence numbers are tracked to count dropped and reordered frames,
+a jump back by more than REORDER_WINDOW frames (device reset, appended captures) restarts the
+tracking from the new sequence number.
+Scaling uses adc7::codeToMicroVolts/NanoVolts with the constants of __adc7_scale.h, the same
+the driver uses on the device.
+
+@code
+struct Sink
+{
+    void operator()( const adc7::TlmFrame &frame ) { ... }
+};
+
+adc7::TlmDecoder decoder;
+Sink sink;
+
+decoder.feed( data, len, sink );
+@endcode
+
+*/
+/* -------------------------------------------------------------------------- */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "__adc7_driver.h"
+#include "__adc7_driver.hpp"
+
+#ifndef _ADC7_DECODER_HPP_
+#define _ADC7_DECODER_HPP_
+
+namespace adc7
+{
+
+/** @defgroup ADC7_DECODER_TYPES Types */                     /** @{ */
+
+/** Decoded telemetry frame */
+struct TlmFrame
+{
+    uint16_t    seq;
+    uint8_t     cfg[ 2 ];                /**< Configuration word, 0 - not known */
+    uint32_t    tickFirst;
+    uint32_t    tickLast;
+    uint8_t     nCodes;
+    int32_t     codes[ _ADC7_TLM_CODES_MAX ];
+
+    uint8_t gainConfig() const      { return (cfg[ 0 ] >> 4) & 0x03; }
+    uint8_t downSampFactor() const  { return cfg[ 0 ] & 0x0F; }
+    uint8_t filterType() const      { return cfg[ 1 ] >> 4; }
+
+    /** Timestamp of code idx, interpolated between the first and the last one */
+    uint32_t tick( uint8_t idx ) const
+    {
+        if (nCodes < 2)
+        {
+            return tickFirst;
+        }
+
+        return tickFirst + (uint32_t)((uint64_t)(uint32_t)(tickLast - tickFirst) * idx / (nCodes - 1));
+    }
+};
+
+/** Decoder counters */
+struct TlmStats
+{
+    uint64_t    bytes;
+    uint64_t    frames;                  /**< Valid frames */
+    uint64_t    samples;
+    uint64_t    crcErrors;
+    uint64_t    formatErrors;            /**< Bad COBS coding, length or version */
+    uint64_t    dropped;                 /**< Frames missing from the sequence when a later one arrived */
+    uint64_t    reordered;               /**< Frames older than the last one, also counted as dropped before */
+    uint64_t    restarts;                /**< Sequence restarts, jumps back by more than REORDER_WINDOW */
+};
+
+                                                                       /** @} */
+/** @defgroup ADC7_DECODER_CLASS Decoder */                   /** @{ */
+
+class TlmDecoder
+{
+public:
+
+    /** Largest encoded frame, delimiter excluded */
+    static const size_t FRAME_MAX = _ADC7_TLM_FRAME_MAX( _ADC7_TLM_CODES_MAX ) - 1;
+
+    /** Largest distance behind the last frame counted as reordered, further back is a restart */
+    static const uint16_t REORDER_WINDOW = 64;
+
+    TlmDecoder()
+    {
+        uint16_t crc;
+        int byte;
+        int bit;
+
+        for (byte = 0; byte < 256; byte++)
+        {
+            crc = (uint16_t)(byte << 8);
+
+            for (bit = 0; bit < 8; bit++)
+            {
+                crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+            }
+
+            _crcTable[ byte ] = crc;
+        }
+
+        reset();
+    }
+
+    /** Clears counters, sequence tracking and a pending partial frame */
+    void reset()
+    {
+        memset( &_stats, 0, sizeof( _stats ) );
+        _pendingLen = 0;
+        _skip = false;
+        _haveSeq = false;
+        _nextSeq = 0;
+    }
+
+    const TlmStats &stats() const
+    {
+        return _stats;
+    }
+
+    /**
+     * @brief Feed function
+     *
+     * @param[in] data  Stream bytes
+     * @param[in] len  Number of bytes
+     * @param[in] sink  Called with every valid frame
+     *
+     * A frame without its delimiter is kept until the next call.
+     */
+    template< class Sink >
+    void feed( const uint8_t *data, size_t len, Sink &sink )
+    {
+        const uint8_t *end = data + len;
+        const uint8_t *zero;
+        size_t n;
+
+        _stats.bytes += len;
+
+        while (data < end)
+        {
+            zero = (const uint8_t *)memchr( data, 0x00, end - data );
+            n = (zero ? zero : end) - data;
+
+            if (_pendingLen || _skip || !zero)
+            {
+                // frame split between calls
+                if (!_skip && (_pendingLen + n <= FRAME_MAX))
+                {
+                    memcpy( _pending + _pendingLen, data, n );
+                    _pendingLen += n;
+                }
+                else
+                {
+                    _skip = true;
+                }
+
+                if (!zero)
+                {
+                    return;
+                }
+
+                if (_skip)
+                {
+                    _stats.formatErrors++;
+                }
+                else
+                {
+                    frame( _pending, _pendingLen, sink );
+                }
+
+                _pendingLen = 0;
+                _skip = false;
+            }
+            else
+            {
+                frame( data, n, sink );
+            }
+
+            data = zero + 1;
+        }
+    }
+
+private:
+
+    template< class Sink >
+    void frame( const uint8_t *enc, size_t len, Sink &sink )
+    {
+        uint8_t raw[ FRAME_MAX ];
+        size_t rawLen;
+        uint16_t crc;
+        uint8_t nCodes;
+        uint8_t idx;
+        const uint8_t *ptr;
+
+        if (len == 0)
+        {
+            return;
+        }
+        if (len > FRAME_MAX)
+        {
+            _stats.formatErrors++;
+            return;
+        }
+        if (!cobsDecode( enc, len, raw, &rawLen ) || (rawLen < _ADC7_TLM_HEADER_LEN + 2) ||
+            (raw[ 0 ] != _ADC7_TLM_VERSION))
+        {
+            _stats.formatErrors++;
+            return;
+        }
+
+        nCodes = raw[ 13 ];
+        if ((nCodes == 0) || (nCodes > _ADC7_TLM_CODES_MAX) || (rawLen != _ADC7_TLM_HEADER_LEN + 4u * nCodes + 2))
+        {
+            _stats.formatErrors++;
+            return;
+        }
+
+        crc = 0xFFFF;
+        for (ptr = raw; ptr < raw + rawLen - 2; ptr++)
+        {
+            crc = (uint16_t)((crc << 8) ^ _crcTable[ (crc >> 8) ^ *ptr ]);
+        }
+        if (crc != get16( raw + rawLen - 2 ))
+        {
+            _stats.crcErrors++;
+            return;
+        }
+
+        _frame.seq = get16( raw + 1 );
+        _frame.cfg[ 0 ] = raw[ 3 ];
+        _frame.cfg[ 1 ] = raw[ 4 ];
+        _frame.tickFirst = get32( raw + 5 );
+        _frame.tickLast = get32( raw + 9 );
+        _frame.nCodes = nCodes;
+
+        for (idx = 0, ptr = raw + _ADC7_TLM_HEADER_LEN; idx < nCodes; idx++, ptr += 4)
+        {
+            _frame.codes[ idx ] = (int32_t)get32( ptr );
+        }
+
+        track( _frame.seq );
+        _stats.frames++;
+        _stats.samples += nCodes;
+
+        sink( _frame );
+    }
+
+    /* Half of the sequence space ahead is a gap, behind is a reordered frame or a restart */
+    void track( uint16_t seq )
+    {
+        uint16_t delta = (uint16_t)(seq - _nextSeq);
+
+        if (!_haveSeq)
+        {
+            _haveSeq = true;
+        }
+        else if (delta < 0x8000)
+        {
+            _stats.dropped += delta;
+        }
+        else if ((uint16_t)(_nextSeq - 1 - seq) < REORDER_WINDOW)
+        {
+            _stats.reordered++;
+            return;
+        }
+        else
+        {
+            _stats.restarts++;
+        }
+
+        _nextSeq = (uint16_t)(seq + 1);
+    }
+
+    static bool cobsDecode( const uint8_t *enc, size_t len, uint8_t *out, size_t *outLen )
+    {
+        const uint8_t *end = enc + len;
+        uint8_t *ptr = out;
+        uint8_t code;
+
+        while (enc < end)
+        {
+            code = *( enc++ );
+
+            if ((size_t)(end - enc) < (size_t)(code - 1))
+            {
+                return false;
+            }
+
+            memcpy( ptr, enc, code - 1 );
+            ptr += code - 1;
+            enc += code - 1;
+
+            if ((code != 0xFF) && (enc < end))
+            {
+                *( ptr++ ) = 0x00;
+            }
+        }
+
+        *outLen = ptr - out;
+
+        return true;
+    }
+
+    static uint16_t get16( const uint8_t *ptr )
+    {
+        return (uint16_t)(ptr[ 0 ] | (ptr[ 1 ] << 8));
+    }
+
+    static uint32_t get32( const uint8_t *ptr )
+    {
+        return (uint32_t)ptr[ 0 ] | ((uint32_t)ptr[ 1 ] << 8) | ((uint32_t)ptr[ 2 ] << 16) | ((uint32_t)ptr[ 3 ] << 24);
+    }
+
+    uint16_t    _crcTable[ 256 ];
+    uint8_t     _pending[ FRAME_MAX ];
+    size_t      _pendingLen;
+    bool        _skip;
+    bool        _haveSeq;
+    uint16_t    _nextSeq;
+    TlmStats    _stats;
+    TlmFrame    _frame;
+};
+
+                                                                       /** @} */
+} // namespace adc7
+
+#endif
+                                                                       /** @} */
+/* -------------------------------------------------------------------------- */
+/*
+  __adc7_decoder.hpp
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+3. All advertising materials mentioning features or use of this software
+   must display the following acknowledgement:
+   This product includes software developed by the MikroElektonika.
+
+4. Neither the name of the MikroElektonika nor the
+   names of its contributors may be used to endorse or promote products
+   derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY MIKROELEKTRONIKA ''AS IS'' AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL MIKROELEKTRONIKA BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------------- */
@@ -0,0 +1,292 @@
+/*
+    adc7dec.cpp
+
+-----------------------------------------------------------------------------
+
+  This file is part of mikroSDK.
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+----------------------------------------------------------------------------- */
+
+/**
+@file   adc7dec.cpp
+@brief    ADC_7 Telemetry Stream Decoder CLI
+
+    g++ -O2 -I../../library adc7dec.cpp -o adc7dec
+
+    adc7dec [-f uv | nv | codes | raw | none] [file]
+
+Decodes an adc7_tlmFrame stream from file (or standard input) and writes one line
+"<tick> <value>" per sample in uV, nV or raw code, raw 32-bit little endian codes (raw),
+or nothing (none, counters only). Counters and the decode rate are reported on standard error,
+exit status is 1 when any frame was lost, damaged or reordered. Sequence restarts (device reset,
+appended captures) are counted but are not an error.
+
+Streams can be produced on Linux by example/c/LINUX/Click_ADC_7_LINUX_tlm.c :
+
+    ./Click_ADC_7_LINUX_tlm capture.bin 1000
+    ./adc7dec -f uv capture.bin
+
+*/
+/* -------------------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "__adc7_decoder.hpp"
+
+#define IN_CHUNK        (1 << 20)
+#define OUT_CHUNK       (1 << 20)
+
+enum Format { FMT_UV, FMT_NV, FMT_CODES, FMT_RAW, FMT_NONE };
+
+/* Buffered writer, integers are formatted without printf */
+class Output
+{
+public:
+
+    Output( FILE *file ) : _file( file ), _len( 0 ) {}
+    ~Output() { flush(); }
+
+    void flush()
+    {
+        fwrite( _buf, 1, _len, _file );
+        _len = 0;
+    }
+
+    void reserve( size_t n )
+    {
+        if (_len + n > OUT_CHUNK)
+        {
+            flush();
+        }
+    }
+
+    void putInt( int64_t value )
+    {
+        char tmp[ 24 ];
+        char *ptr = tmp + sizeof( tmp );
+        uint64_t magnitude = (value < 0) ? (uint64_t)-(value + 1) + 1 : (uint64_t)value;
+
+        do
+        {
+            *( --ptr ) = (char)('0' + magnitude % 10);
+            magnitude /= 10;
+        } while (magnitude);
+
+        if (value < 0)
+        {
+            *( --ptr ) = '-';
+        }
+
+        memcpy( _buf + _len, ptr, tmp + sizeof( tmp ) - ptr );
+        _len += tmp + sizeof( tmp ) - ptr;
+    }
+
+    void putChar( char c )
+    {
+        _buf[ _len++ ] = c;
+    }
+
+    void putRaw( int32_t code )
+    {
+        uint32_t value = (uint32_t)code;
+
+        _buf[ _len++ ] = (char)value;
+        _buf[ _len++ ] = (char)(value >> 8);
+        _buf[ _len++ ] = (char)(value >> 16);
+        _buf[ _len++ ] = (char)(value >> 24);
+    }
+
+private:
+
+    FILE    *_file;
+    size_t  _len;
+    char    _buf[ OUT_CHUNK ];
+};
+
+class Sink
+{
+public:
+
+    Sink( Format format, Output &out ) : _format( format ), _out( out ) {}
+
+    void operator()( const adc7::TlmFrame &frame )
+    {
+        uint8_t gain = frame.gainConfig();
+        uint8_t idx;
+
+        if (_format == FMT_NONE)
+        {
+            return;
+        }
+
+        _out.reserve( frame.nCodes * 48 );
+
+        for (idx = 0; idx < frame.nCodes; idx++)
+        {
+            if (_format == FMT_RAW)
+            {
+                _out.putRaw( frame.codes[ idx ] );
+                continue;
+            }
+
+            _out.putInt( frame.tick( idx ) );
+            _out.putChar( ' ' );
+
+            if (_format == FMT_UV)
+            {
+                _out.putInt( adc7::codeToMicroVolts( frame.codes[ idx ], gain ) );
+            }
+            else if (_format == FMT_NV)
+            {
+                _out.putInt( adc7::codeToNanoVolts( frame.codes[ idx ], gain ) );
+            }
+            else
+            {
+                _out.putInt( frame.codes[ idx ] );
+            }
+
+            _out.putChar( '\n' );
+        }
+    }
+
+private:
+
+    Format  _format;
+    Output  &_out;
+};
+
+static double seconds( void )
+{
+    struct timespec ts;
+
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main( int argc, char **argv )
+{
+    static uint8_t in[ IN_CHUNK ];
+    static adc7::TlmDecoder decoder;
+    Format format = FMT_UV;
+    FILE *file = stdin;
+    const char *name = 0;
+    double start;
+    double elapsed;
+    size_t len;
+    int arg;
+
+    for (arg = 1; arg < argc; arg++)
+    {
+        if (!strcmp( argv[ arg ], "-f" ) && (arg + 1 < argc))
+        {
+            const char *fmt = argv[ ++arg ];
+
+            if (!strcmp( fmt, "uv" ))          format = FMT_UV;
+            else if (!strcmp( fmt, "nv" ))     format = FMT_NV;
+            else if (!strcmp( fmt, "codes" ))  format = FMT_CODES;
+            else if (!strcmp( fmt, "raw" ))    format = FMT_RAW;
+            else if (!strcmp( fmt, "none" ))   format = FMT_NONE;
+            else
+            {
+                fprintf( stderr, "unknown format %s\n", fmt );
+                return 2;
+            }
+        }
+        else if (!name)
+        {
+            name = argv[ arg ];
+        }
+        else
+        {
+            fprintf( stderr, "usage: %s [-f uv | nv | codes | raw | none] [file]\n", argv[ 0 ] );
+            return 2;
+        }
+    }
+
+    if (name)
+    {
+        file = fopen( name, "rb" );
+        if (!file)
+        {
+            perror( name );
+            return 2;
+        }
+    }
+
+    {
+        Output out( stdout );
+        Sink sink( format, out );
+
+        start = seconds();
+
+        while ((len = fread( in, 1, sizeof( in ), file )) > 0)
+        {
+            decoder.feed( in, len, sink );
+        }
+
+        elapsed = seconds() - start;
+    }
+
+    if (file != stdin)
+    {
+        fclose( file );
+    }
+
+    const adc7::TlmStats &stats = decoder.stats();
+
+    fprintf( stderr, "bytes %llu, frames %llu, samples %llu, crc errors %llu, format errors %llu, "
+             "dropped %llu, reordered %llu, restarts %llu, %.1f MB/s\n",
+             (unsigned long long)stats.bytes, (unsigned long long)stats.frames,
+             (unsigned long long)stats.samples, (unsigned long long)stats.crcErrors,
+             (unsigned long long)stats.formatErrors, (unsigned long long)stats.dropped,
+             (unsigned long long)stats.reordered, (unsigned long long)stats.restarts,
+             elapsed > 0 ? stats.bytes / elapsed * 1e-6 : 0.0 );
+
+    return (stats.crcErrors || stats.formatErrors || stats.dropped || stats.reordered) ? 1 : 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/*
+  adc7dec.cpp
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+3. All advertising materials mentioning features or use of this software
+   must display the following acknowledgement:
+   This product includes software developed by the MikroElektonika.
+
+4. Neither the name of the MikroElektonika nor the
+   names of its contributors may be used to endorse or promote products
+   derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY MIKROELEKTRONIKA ''AS IS'' AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL MIKROELEKTRONIKA BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------------- */
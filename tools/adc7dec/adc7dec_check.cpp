@@ -0,0 +1,219 @@
+/*
+    adc7dec_check.cpp
+
+-----------------------------------------------------------------------------
+
+  This file is part of mikroSDK.
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+----------------------------------------------------------------------------- */
+
+/**
+@file   adc7dec_check.cpp
+@brief    ADC_7 Telemetry Stream Decoder Self-Check
+
+    gcc -c -I../../library ../../library/__adc7_driver.c ../../library/__adc7_sim.c
+    g++ -O2 -I../../library adc7dec_check.cpp __adc7_driver.o __adc7_sim.o -o adc7dec_check
+
+Builds streams from frames encoded by adc7_ctxTlmFrame, with the sequence number set per frame,
+and checks the decoder counters and the decoded codes.
+
+- In order - no frame may be counted as dropped, reordered or restarted.
+- Gap - the missing frames must be counted as dropped.
+- Reordered - a frame older than the last one must be counted once as reordered.
+- Restart - a capture appended to itself, and a device reset in the middle of a stream, must be
+  counted as one restart each, and a gap after the restart must still be counted as dropped.
+- Split - the stream fed a few bytes per call must decode the same as in one call.
+- Damaged - a frame with a flipped byte must be counted as a CRC error and as dropped.
+
+Exits with 1 if any check fails.
+
+*/
+/* -------------------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <string.h>
+#include "__adc7_driver.h"
+#include "__adc7_decoder.hpp"
+
+#define STREAM_MAX      (1 << 20)
+#define CODES           16
+#define FRAMES          200
+#define APPENDED        4
+#define SPLIT_CHUNK     7
+
+T_adc7_ctx ctx;
+
+uint8_t stream[ STREAM_MAX ];
+size_t streamLen;
+uint32_t errors;
+
+/* Checks every decoded code against the one encoded for the sequence number */
+class Sink
+{
+public:
+
+    Sink() : badCodes( 0 ) {}
+
+    void operator()( const adc7::TlmFrame &frame )
+    {
+        uint8_t idx;
+
+        for (idx = 0; idx < frame.nCodes; idx++)
+        {
+            if (frame.codes[ idx ] != codeOf( frame.seq, idx ))
+            {
+                badCodes++;
+            }
+        }
+    }
+
+    static int32_t codeOf( uint16_t seq, uint8_t idx )
+    {
+        return (int32_t)(((uint32_t)seq << 16) | idx) - 0x40000000;
+    }
+
+    uint32_t badCodes;
+};
+
+void append( uint16_t seq )
+{
+    int32_t codes[ CODES ];
+    uint32_t ticks[ CODES ];
+    uint8_t idx;
+
+    for (idx = 0; idx < CODES; idx++)
+    {
+        codes[ idx ] = Sink::codeOf( seq, idx );
+        ticks[ idx ] = (uint32_t)seq * CODES + idx;
+    }
+
+    ctx.tlmSeq = seq;
+    streamLen += adc7_ctxTlmFrame( &ctx, codes, ticks, CODES, stream + streamLen );
+}
+
+void appendRange( uint16_t first, uint16_t count )
+{
+    uint16_t idx;
+
+    for (idx = 0; idx < count; idx++)
+    {
+        append( (uint16_t)(first + idx) );
+    }
+}
+
+void check( const char *name, size_t chunk, uint64_t frames, uint64_t dropped, uint64_t reordered,
+            uint64_t restarts, uint64_t crcErrors )
+{
+    adc7::TlmDecoder decoder;
+    Sink sink;
+    size_t pos;
+
+    for (pos = 0; pos < streamLen; pos += chunk)
+    {
+        decoder.feed( stream + pos, (streamLen - pos < chunk) ? streamLen - pos : chunk, sink );
+    }
+
+    const adc7::TlmStats &stats = decoder.stats();
+
+    printf( "%-12s : frames %llu, dropped %llu, reordered %llu, restarts %llu, crc errors %llu\n", name,
+            (unsigned long long)stats.frames, (unsigned long long)stats.dropped,
+            (unsigned long long)stats.reordered, (unsigned long long)stats.restarts,
+            (unsigned long long)stats.crcErrors );
+
+    if ((stats.frames != frames) || (stats.dropped != dropped) || (stats.reordered != reordered) ||
+        (stats.restarts != restarts) || (stats.crcErrors != crcErrors) || stats.formatErrors || sink.badCodes)
+    {
+        printf( "%-12s : wrong counters or codes\n", name );
+        errors++;
+    }
+
+    streamLen = 0;
+}
+
+int main()
+{
+    uint16_t copy;
+
+    appendRange( 0, FRAMES );
+    check( "in order", STREAM_MAX, FRAMES, 0, 0, 0, 0 );
+
+    // sequence wraps around in the middle
+    appendRange( 0xFFF0, 32 );
+    check( "wrap", STREAM_MAX, 32, 0, 0, 0, 0 );
+
+    appendRange( 0, 10 );
+    appendRange( 15, 10 );
+    check( "gap", STREAM_MAX, 20, 5, 0, 0, 0 );
+
+    appendRange( 0, 10 );
+    append( 11 );
+    append( 10 );
+    appendRange( 12, 10 );
+    check( "reordered", STREAM_MAX, 22, 1, 1, 0, 0 );
+
+    for (copy = 0; copy < APPENDED; copy++)
+    {
+        appendRange( 0, FRAMES );
+    }
+    check( "appended", STREAM_MAX, APPENDED * FRAMES, 0, 0, APPENDED - 1, 0 );
+
+    appendRange( 5000, 100 );
+    appendRange( 0, 10 );
+    appendRange( 12, 10 );
+    check( "reset", STREAM_MAX, 120, 2, 0, 1, 0 );
+
+    appendRange( 0, FRAMES );
+    check( "split", SPLIT_CHUNK, FRAMES, 0, 0, 0, 0 );
+
+    appendRange( 0, 10 );
+    stream[ streamLen - 5 ] ^= 0x01;
+    appendRange( 10, 10 );
+    check( "damaged", STREAM_MAX, 19, 1, 0, 0, 1 );
+
+    printf( "%u errors\n", errors );
+
+    return errors ? 1 : 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/*
+  adc7dec_check.cpp
+
+  Copyright (c) 2017, MikroElektonika - http://www.mikroe.com
+
+  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+3. All advertising materials mentioning features or use of this software
+   must display the following acknowledgement:
+   This product includes software developed by the MikroElektonika.
+
+4. Neither the name of the MikroElektonika nor the
+   names of its contributors may be used to endorse or promote products
+   derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY MIKROELEKTRONIKA ''AS IS'' AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL MIKROELEKTRONIKA BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------------- */